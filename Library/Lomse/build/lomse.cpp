@@ -101,6 +101,7 @@
 #include "../src/gui_controls/lomse_score_player_ctrl.cpp"
 #include "../src/gui_controls/lomse_static_text_ctrl.cpp"
 #include "../src/internal_model/lomse_im_algorithms.cpp"
+#include "../src/internal_model/lomse_im_arena.cpp"
 #include "../src/internal_model/lomse_im_attributes.cpp"
 #include "../src/internal_model/lomse_im_factory.cpp"
 #include "../src/internal_model/lomse_im_figured_bass.cpp"
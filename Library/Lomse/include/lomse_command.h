@@ -997,6 +997,9 @@ public:
     void undo_action(Document* pDoc, DocCursor* pCursor);
     ///@endcond
 
+protected:
+    void update_score(Document* pDoc, ImoScore* pScore);
+
 };
 
 //---------------------------------------------------------------------------------------
@@ -51,6 +51,7 @@ class DocCommand;
 class DocCommandExecuter;
 class Compiler;
 class IdAssigner;
+class ImoArena;
 class Interactor;
 class ImoDocument;
 class ImoMusicData;
@@ -150,6 +151,7 @@ protected:
     ostream&        m_reporter;
     DocumentScope   m_docScope;
     IdAssigner*     m_pIdAssigner;
+    ImoArena*       m_pArena;           //memory for ImoObj, or nullptr to use the heap
     ImoDocument*    m_pImoDoc;
     unsigned int    m_flags;
     int             m_modified;
@@ -257,6 +259,11 @@ public:
         %Document provides facade methods for the most common operations. */
     inline ImoDocument* get_im_root() const { return m_pImoDoc; }
 
+    /** Returns the memory pool for the objects of the internal model, or
+        @nullptr when they are allocated in the heap. It is used when option
+        LibraryScope::use_imo_arena() is enabled. */
+    inline ImoArena* get_imo_arena() const { return m_pArena; }
+
     /** For %Document objects created from sources in LMD format this method will return
         the LMD version used in the source. For %Document objects created from
         sources in other formats it will return version "0.0". */
@@ -655,6 +662,9 @@ public:
 
     //internal model and ID management
     void on_removed_from_model(ImoObj* pImo);
+    void begin_concurrent_building();
+    void log_ids_assigned_by_this_thread(vector<ImoId>* pLog);
+    void end_concurrent_building(const vector< vector<ImoId> >& logs);
 
     //undo/redo support
     int from_checkpoint(const string& data);
@@ -339,6 +339,10 @@ public:
     /** The View is requested to re-paint itself onto the window */
     virtual void redraw_bitmap();
 
+    /** The rendering buffer content was replaced by the user application with the
+        rendering of current viewport. Only visual effects are re-painted onto it */
+    virtual void redraw_visual_effects();
+
     //graphical model
     GraphicModel* get_graphic_model();
 
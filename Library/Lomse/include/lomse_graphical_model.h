@@ -33,6 +33,7 @@
 #include "lomse_basic.h"
 #include "lomse_observable.h"
 #include "lomse_events.h"
+#include "lomse_id_table.h"
 
 #include <vector>
 #include <list>
@@ -128,8 +129,8 @@ protected:
     GmoBoxDocument* m_root;
     long m_modelId;
     bool m_modified;
-    map<ImoId, GmoBox*> m_imoToBox;
-    map<ImoId, GmoShape*> m_imoToMainShape;
+    IdTable<GmoBox> m_imoToBox;
+    IdTable<GmoShape> m_imoToMainShape;
     map< pair<ImoId, ShapeId>, GmoShape*> m_imoToSecondaryShape;
     map<GmoRef, GmoObj*> m_ctrolToPtr;
     map<ImoId, ScoreStub*> m_scores;
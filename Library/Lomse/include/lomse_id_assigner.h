@@ -31,9 +31,11 @@
 #define __LOMSE_ID_ASSIGNER_H__
 
 #include "lomse_basic.h"
+#include "lomse_id_table.h"
 
-#include <map>
+#include <mutex>
 #include <string>
+#include <vector>
 using namespace std;
 
 namespace lomse
@@ -50,8 +52,11 @@ class IdAssigner
 {
 protected:
     ImoId m_idCounter;
-    std::map<ImoId, ImoObj*> m_idToImo;
-    std::map<ImoId, Control*> m_idToControl;
+    IdTable<ImoObj> m_idToImo;
+    IdTable<Control> m_idToControl;
+    bool m_fConcurrent;             //ids are being assigned from several threads
+    ImoId m_idBase;                 //last id assigned before going concurrent
+    mutable std::mutex m_mutex;
 
 public:
     IdAssigner();
@@ -67,6 +72,11 @@ public:
     void remove(ImoObj* pImo);
     void copy_ids_to(IdAssigner* assigner, ImoId idMin);
 
+    //assigning ids from several threads
+    void begin_concurrent_assignment();
+    void log_ids_assigned_by_this_thread(std::vector<ImoId>* pLog);
+    void end_concurrent_assignment(const std::vector< std::vector<ImoId> >& logs);
+
     //debug
     string dump() const;
     inline size_t size() const { return m_idToImo.size(); }
@@ -74,6 +84,7 @@ public:
 protected:
     void add_id(ImoId id, ImoObj* pImo);
     void add_control_id(ImoId id, Control* pControl);
+    std::unique_lock<std::mutex> lock_if_concurrent() const;
 
 };
 
@@ -0,0 +1,229 @@
+//---------------------------------------------------------------------------------------
+// This file is part of the Lomse library.
+// Lomse is copyrighted work (c) 2010-2016. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice, this
+//      list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright notice, this
+//      list of conditions and the following disclaimer in the documentation and/or
+//      other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+// OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+// SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+// TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+// BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+// ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+//
+// For any comment, suggestion or feature request, please contact the manager of
+// the project at cecilios@users.sourceforge.net
+//---------------------------------------------------------------------------------------
+
+#ifndef __LOMSE_ID_TABLE_H__
+#define __LOMSE_ID_TABLE_H__
+
+#include "lomse_basic.h"
+
+#include <algorithm>
+#include <map>
+#include <vector>
+
+namespace lomse
+{
+
+//---------------------------------------------------------------------------------------
+//IdTable: maps ImoId to objects. Ids are assigned sequentially, so the table is
+// an array indexed by id, split in fixed size pages: lookup is two indexing
+// operations and unused ranges of ids only cost a null pointer per page. Pages for
+// very high ids are kept in a map, so a few of them do not require a directory
+// for all pages below.
+// Removed entries are left as null slots (tombstones) and a page is released
+// as soon as all its entries are removed. Negative ids are never stored.
+template <class T>
+class IdTable
+{
+protected:
+    enum { k_page_bits = 10, k_page_size = 1 << k_page_bits,
+           k_max_dense_pages = 4096      //dense directory for ids up to 4M
+    };
+
+    struct Page
+    {
+        T* items[k_page_size];
+        int numItems;
+
+        Page() : numItems(0) { std::fill(items, items + k_page_size, nullptr); }
+    };
+
+    std::vector<Page*> m_pages;
+    std::map<size_t, Page*> m_farPages;     //pages not in the dense directory
+    size_t m_size;
+
+public:
+    IdTable() : m_size(0) {}
+    ~IdTable() { clear(); }
+
+    IdTable(const IdTable&) = delete;
+    IdTable& operator=(const IdTable&) = delete;
+
+    //---------------------------------------------------------------------------------
+    T* get(ImoId id) const
+    {
+        if (id < 0)
+            return nullptr;
+        Page* pPage = find_page(size_t(id) >> k_page_bits);
+        if (pPage == nullptr)
+            return nullptr;
+        return pPage->items[id & (k_page_size - 1)];
+    }
+
+    //---------------------------------------------------------------------------------
+    void set(ImoId id, T* pObj)
+    {
+        if (id < 0)
+            return;
+        if (pObj == nullptr)
+        {
+            erase(id);
+            return;
+        }
+
+        Page*& pPage = page_slot(size_t(id) >> k_page_bits);
+        if (pPage == nullptr)
+            pPage = LOMSE_NEW Page();
+
+        T*& pItem = pPage->items[id & (k_page_size - 1)];
+        if (pItem == nullptr)
+        {
+            ++pPage->numItems;
+            ++m_size;
+        }
+        pItem = pObj;
+    }
+
+    //---------------------------------------------------------------------------------
+    void erase(ImoId id)
+    {
+        if (id < 0)
+            return;
+        size_t iPage = size_t(id) >> k_page_bits;
+        Page* pPage = find_page(iPage);
+        if (pPage == nullptr)
+            return;
+
+        T*& pItem = pPage->items[id & (k_page_size - 1)];
+        if (pItem != nullptr)
+        {
+            pItem = nullptr;
+            --m_size;
+            if (--pPage->numItems == 0)
+            {
+                delete pPage;
+                if (iPage < k_max_dense_pages)
+                    m_pages[iPage] = nullptr;
+                else
+                    m_farPages.erase(iPage);
+            }
+        }
+    }
+
+    //---------------------------------------------------------------------------------
+    //Returns the lowest id greater than 'id' having an entry, or k_no_imoid if
+    //none. Start with k_no_imoid for traversing the table in id order.
+    ImoId next_id(ImoId id) const
+    {
+        size_t i = (id < 0 ? 0 : size_t(id) + 1);
+        size_t iPage = i >> k_page_bits;
+        for (; iPage < m_pages.size(); ++iPage, i = iPage << k_page_bits)
+        {
+            ImoId next = next_in_page(m_pages[iPage], iPage, i);
+            if (next != k_no_imoid)
+                return next;
+        }
+
+        typename std::map<size_t, Page*>::const_iterator it;
+        for (it = m_farPages.lower_bound(iPage); it != m_farPages.end(); ++it)
+        {
+            if (it->first != iPage)
+                i = it->first << k_page_bits;
+            ImoId next = next_in_page(it->second, it->first, i);
+            if (next != k_no_imoid)
+                return next;
+        }
+        return k_no_imoid;
+    }
+
+    //---------------------------------------------------------------------------------
+    //Releases the slots for pages above the highest id in use
+    void compact()
+    {
+        while (!m_pages.empty() && m_pages.back() == nullptr)
+            m_pages.pop_back();
+        m_pages.shrink_to_fit();
+    }
+
+    //---------------------------------------------------------------------------------
+    void clear()
+    {
+        for (Page* pPage : m_pages)
+            delete pPage;
+        std::vector<Page*>().swap(m_pages);
+        for (auto& page : m_farPages)
+            delete page.second;
+        m_farPages.clear();
+        m_size = 0;
+    }
+
+    inline size_t size() const { return m_size; }
+    inline bool empty() const { return m_size == 0; }
+
+protected:
+    //---------------------------------------------------------------------------------
+    Page* find_page(size_t iPage) const
+    {
+        if (iPage < m_pages.size())
+            return m_pages[iPage];
+        if (iPage < k_max_dense_pages)
+            return nullptr;
+        typename std::map<size_t, Page*>::const_iterator it = m_farPages.find(iPage);
+        return (it != m_farPages.end() ? it->second : nullptr);
+    }
+
+    //---------------------------------------------------------------------------------
+    Page*& page_slot(size_t iPage)
+    {
+        if (iPage >= k_max_dense_pages)
+            return m_farPages[iPage];
+        if (iPage >= m_pages.size())
+            m_pages.resize(iPage + 1, nullptr);
+        return m_pages[iPage];
+    }
+
+    //---------------------------------------------------------------------------------
+    //Returns the lowest id not lower than 'i' having an entry in page iPage
+    static ImoId next_in_page(Page* pPage, size_t iPage, size_t i)
+    {
+        if (pPage == nullptr)
+            return k_no_imoid;
+        for (size_t j = i & (k_page_size - 1); j < k_page_size; ++j)
+        {
+            if (pPage->items[j] != nullptr)
+                return ImoId((iPage << k_page_bits) + j);
+        }
+        return k_no_imoid;
+    }
+
+};
+
+
+} //namespace lomse
+
+#endif    //__LOMSE_ID_TABLE_H__
@@ -0,0 +1,110 @@
+//---------------------------------------------------------------------------------------
+// This file is part of the Lomse library.
+// Lomse is copyrighted work (c) 2010-2016. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice, this
+//      list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright notice, this
+//      list of conditions and the following disclaimer in the documentation and/or
+//      other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+// OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+// SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+// TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+// BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+// ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+//
+// For any comment, suggestion or feature request, please contact the manager of
+// the project at cecilios@users.sourceforge.net
+//---------------------------------------------------------------------------------------
+
+#ifndef __LOMSE_IM_ARENA_H__
+#define __LOMSE_IM_ARENA_H__
+
+#include <cstddef>
+#include <mutex>
+#include <vector>
+
+namespace lomse
+{
+
+//---------------------------------------------------------------------------------------
+//ImoArena: memory pool for the ImoObj objects of a Document.
+// Objects are carved from big chunks, with a free list for each block size. This
+// replaces millions of small heap allocations by a few big ones, keeps objects created
+// together close in memory and makes deleting an object just a push into a free list.
+// The chunks are freed in bulk when the Document releases the arena and no block
+// is still in use.
+//
+// ImoObj::operator new takes memory from the arena current in the calling thread
+// (set by ImFactory for the Document being built), or from the heap when there is
+// no current arena. Each block has a small header pointing to its arena, so that
+// ImoObj::operator delete can return it to the right place.
+class ImoArena
+{
+protected:
+    enum {
+        k_granularity = 16,                     //block sizes are multiple of this
+        k_max_block = 1024,                     //bigger objects are taken from the heap
+        k_num_sizes = k_max_block / k_granularity,
+        k_chunk_size = 256 * 1024,
+    };
+
+    std::vector<char*> m_chunks;
+    char* m_pFree;                  //first unused byte in current chunk
+    char* m_pEnd;                   //end of current chunk
+    void* m_freeBlocks[k_num_sizes];    //list of deleted blocks for each size
+    size_t m_numBlocks;             //blocks in use
+    size_t m_numAllocations;        //total number of blocks allocated
+    bool m_fReleased;               //the owner will not use the arena any more
+    bool m_fConcurrent;             //blocks are allocated from several threads
+    std::mutex m_mutex;
+
+public:
+    ImoArena();
+
+    void release();
+    void set_concurrent(bool value) { m_fConcurrent = value; }
+
+    //statistics
+    inline size_t num_blocks() const { return m_numBlocks; }
+    inline size_t num_allocations() const { return m_numAllocations; }
+    inline size_t reserved_bytes() const { return m_chunks.size() * k_chunk_size; }
+
+    //used by ImoObj::operator new / delete
+    static void* allocate(size_t size);
+    static void deallocate(void* p);
+
+    //sets the arena to use in current thread while the object exists
+    class Scope
+    {
+    protected:
+        ImoArena* m_pPrevious;
+
+    public:
+        Scope(ImoArena* pArena);
+        ~Scope();
+    };
+
+protected:
+    ~ImoArena();
+
+    void* allocate_block(size_t iSize);
+    bool free_block(void* pBlock, size_t iSize);
+    char* new_chunk();
+
+};
+
+
+}   //namespace lomse
+
+#endif      //__LOMSE_IM_ARENA_H__
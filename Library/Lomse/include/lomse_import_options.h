@@ -80,9 +80,13 @@ namespace lomse
 		<td>When %true, if an score part has pitched notes but the clef is missing,
             the importer will assume a G or an F4 clef, depending on notes pitch
             range.</td></tr>
+	<tr><td>analysis_threads</td>		<td>1</td>
+		<td>Maximum number of threads for analysing the parts of a score. Value 1
+            means analysing parts one after the other, and value 0 means using one
+            thread per available processor core.</td></tr>
 	</table>
 
-	@see fix_beams(), use_default_clefs()
+	@see fix_beams(), use_default_clefs(), analysis_threads()
 */
 class MusicXmlOptions
 {
@@ -96,11 +100,13 @@ private:
             MusicXmlOptionsSettings()
                 : m_fFixBeams(true)
                 , m_fDefaultClef(true)
+                , m_nThreads(1)
             {
             }
 
             bool m_fFixBeams;
             bool m_fDefaultClef;
+            int m_nThreads;
 
     };
 
@@ -120,6 +126,9 @@ public:
 	/** Returns current setting for the 'use_default_clefs' option.    */
     inline bool use_default_clefs() { return m_settings.m_fDefaultClef; }
 
+	/** Returns current setting for the 'analysis_threads' option.    */
+    inline int analysis_threads() { return m_settings.m_nThreads; }
+
     //setters (only for options that can be changed without rebuilding the object)
     /** Sets the value for 'fix_beams' option. When %true, if beam information is not
         congruent with note type, the importer will fix the beam.    */
@@ -130,6 +139,13 @@ public:
         an F4 clef, depending on notes pitch range.    */
     inline void use_default_clefs(bool value) { m_settings.m_fDefaultClef = value; }
 
+    /** Sets the value for 'analysis_threads' option: the maximum number of threads
+        for analysing the parts of a score. Parts are independent, so in scores with
+        many parts loading time is reduced when analysing them concurrently. Value 1
+        means analysing parts one after the other, and value 0 means using one
+        thread per available processor core.    */
+    inline void analysis_threads(int value) { m_settings.m_nThreads = value; }
+
 };
 
 
@@ -109,6 +109,7 @@ protected:
 
     //options
     bool m_fReplaceLocalMetronome;
+    bool m_fUseImoArena;            //documents allocate their ImoObj in an ImoArena
     MusicXmlOptions m_importOptions;
 
     //debug options
@@ -175,6 +176,8 @@ public:
     inline Metronome* get_global_metronome() { return m_pGlobalMetronome; }
     inline bool global_metronome_replaces_local() { return m_fReplaceLocalMetronome; }
     inline MusicXmlOptions* get_musicxml_options() { return &m_importOptions; }
+    inline void set_use_imo_arena(bool value) { m_fUseImoArena = value; }
+    inline bool use_imo_arena() { return m_fUseImoArena; }
 
     //spacing and lines breaker algorithm parameters
     inline bool use_debug_values() { return m_fUseDbgValues; }
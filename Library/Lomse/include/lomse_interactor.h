@@ -384,6 +384,18 @@ public:
     virtual void redraw_bitmap();
 
 
+    /** Invoking this method informs Lomse that your application has replaced the
+        content of the rendering buffer with a rendering of the current viewport,
+        i.e. rendered in advance by another View of the same document. Lomse takes
+        the buffer content as the new background and only renders the visual effects
+        (tempo line, marks, caret, selection) onto it. As with redraw_bitmap(), Lomse
+        <b>does not</b> generate a EventPaint event.
+
+        @see redraw_bitmap(), new_viewport().
+    */
+    virtual void redraw_visual_effects();
+
+
     /** Invoking this method forces Lomse to render again the View and, therefore,
         the rendering buffer gets updated. After doing it, Lomse <b>will</b>
         generate a EventPaint event.
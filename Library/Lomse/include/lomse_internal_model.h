@@ -45,6 +45,7 @@
 #include "lomse_injectors.h"
 #include "lomse_image.h"
 #include "lomse_logger.h"
+#include "lomse_im_arena.h"
 typedef int TIntAttribute;
 
 using namespace std;
@@ -1208,6 +1209,10 @@ protected:
 public:
     virtual ~ImoObj();
 
+    //memory is taken from the ImoArena of the document, if it has one
+    static void* operator new(size_t size) { return ImoArena::allocate(size); }
+    static void operator delete(void* p) { ImoArena::deallocate(p); }
+
     //flag values
     enum
     {
@@ -6130,6 +6135,13 @@ public:
         that will invoke this method on all scores. */
     void end_of_changes();
 
+    /** Same as end_of_changes() but for changes restricted to the staffobjs of
+        instrument <i>iInstr</i> in measures <i>firstMeasure</i> to <i>lastMeasure</i>
+        (0 based, numbered as before the changes). Previous measures, and the barline
+        ending them, must not have been modified. Only the affected part of the
+        structures is rebuilt, when possible. */
+    void end_of_changes(int iInstr, int firstMeasure, int lastMeasure);
+
 
 protected:
     void add_option(ImoOptionInfo* pOpt);
@@ -6234,6 +6246,12 @@ public:
         return m_pBezier;
     }
 
+    //setters
+    inline void set_slur_number(int num)
+    {
+        m_slurNum = num;
+    }
+
     //edition
     ImoBezierInfo* add_bezier();
 };
@@ -6709,6 +6727,12 @@ public:
         return m_pBezier;
     }
 
+    //setters
+    inline void set_tie_number(int num)
+    {
+        m_tieNum = num;
+    }
+
     //edition
     ImoBezierInfo* add_bezier();
 };
@@ -40,6 +40,7 @@ namespace lomse
 {
 
 class ColStaffObjsEntry;
+class ImoStaffObj;
 
 //---------------------------------------------------------------------------------------
 // ImMeasuresTableEntry: an entry in the ImMeasuresTable table
@@ -53,8 +54,8 @@ protected:
     TimeUnits   m_bottomBeat;       //applicable TS bottom number (as note duration)
     TimeUnits   m_impliedBeat;      //implied beat duration for applicable TS
 
-	ColStaffObjsEntry* m_pCsoEntry; //ptr to barline (end of this measure) or nullptr
-	                                //when no end barline
+	ImoStaffObj* m_pStaffObj;       //first staffobj in the measure. Not the ColStaffObjs
+	                                //entry, as entries move when the table is updated
 
 public:
     ImMeasuresTableEntry(ColStaffObjsEntry* pEntry);
@@ -66,7 +67,7 @@ public:
 	inline ImoId get_first_id() const { return m_firstId; }
 	inline TimeUnits get_implied_beat_duration() const { return m_bottomBeat; }
 	inline TimeUnits get_bottom_ts_beat_duration() const { return m_impliedBeat; }
-    inline ColStaffObjsEntry* get_entry() const { return m_pCsoEntry; }
+    inline ImoStaffObj* get_staffobj() const { return m_pStaffObj; }
 
     //debug
     string dump();
@@ -81,7 +82,7 @@ protected:
 	inline void set_first_id(ImoId id) { m_firstId = id; }
 	inline void set_implied_beat_duration(TimeUnits duration) { m_bottomBeat = duration; }
 	inline void set_bottom_ts_beat_duration(TimeUnits duration) { m_impliedBeat = duration; }
-	inline void set_entry(ColStaffObjsEntry* entry) { m_pCsoEntry = entry; }
+	inline void set_staffobj(ImoStaffObj* pSO) { m_pStaffObj = pSO; }
 
 };
 
@@ -105,6 +106,7 @@ public:
 
     //table management
     ImMeasuresTableEntry* add_entry(ColStaffObjsEntry* pCsoEntry);
+    void delete_entries_from(int iMeasure);
 
     //access to entries
     ImMeasuresTableEntry* get_measure(int iMeasure);
@@ -113,6 +115,7 @@ public:
 
     //search
     ImMeasuresTableEntry* get_measure_at(TimeUnits timepos);
+    ImMeasuresTableEntry* find_measure_starting_with(ImoStaffObj* pSO);
 
     //debug
     string dump();
@@ -66,9 +66,28 @@ public:
 
     ImoDocument* build_model(ImoDocument* pImoDoc);
     void structurize(ImoObj* pImo);
+    void update_structure(ImoScore* pScore, int iInstr, int firstMeasure,
+                          int lastMeasure);
 
 };
 
+//---------------------------------------------------------------------------------------
+// StructureChecker. Debug tool for testing the update of score structures after
+// changes. It checks that the ColStaffObjs table, the measures tables, the timepos of
+// staffobjs and the pitch of notes are the same that ModelBuilder::structurize()
+// creates. AWARE: For the check, the score is structurized again.
+class StructureChecker
+{
+public:
+    StructureChecker() {}
+    virtual ~StructureChecker() {}
+
+    bool check(ImoScore* pScore, ostream& reporter);
+
+protected:
+    string dump_structures(ImoScore* pScore);
+};
+
 //---------------------------------------------------------------------------------------
 /** PitchAssigner. Implements the algorithm to traverse the score and assign pitch to
     notes, based on notated pitch, and taking into account key signature and notated
@@ -84,6 +103,8 @@ public:
     virtual ~PitchAssigner() {}
 
     void assign_pitch(ImoScore* pScore);
+    void update_pitch(ImoScore* pScore, int iInstr, ColStaffObjsEntry* pFirst,
+                      ColStaffObjsEntry* pLast, bool fKeysUpdated);
 
 protected:
     void reset_accidentals(ImoKeySignature* pKey, int idx);
@@ -132,8 +153,11 @@ public:
     virtual ~MeasuresTableBuilder();
 
 	void build(ImoScore* pScore);
+	void update(ImoScore* pScore, int iInstr, ColStaffObjsEntry* pFirst);
 
 protected:
+    void add_to_measures(ImoScore* pScore, ColStaffObjsEntry* pCsoEntry);
+    static bool is_end_of_measure(ColStaffObjsEntry* pCsoEntry, int iInstr);
     void start_measures_table_for(int iInstr, ImoInstrument* pInstr,
                                   ColStaffObjsEntry* pCsoEntry);
     void finish_current_measure(int iInstr);
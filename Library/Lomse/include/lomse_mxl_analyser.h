@@ -156,7 +156,7 @@ public:
     void add_all_instruments(ImoScore* pScore);
     void check_if_missing_parts(ostream& reporter);
 
-    //for unit tests
+    //for unit tests and for copies of the list
     void do_not_delete_instruments_in_destructor() { m_fInstrumentsAdded = true; }
 
 protected:
@@ -222,6 +222,8 @@ protected:
     vector<ImoLyric*>   m_lyrics;
     map<string, int>    m_soundIdToIdx;     //conversion sound-instrument id to index
 	vector<ImoMidiInfo*> m_latestMidiInfo;  //latest MidiInfo for each soundIdx
+    bool                m_fPartWorker;      //analysing a single part, concurrently with others
+    vector< pair<ImoInstrument*, LUnits> > m_lyricsSpaceAfter;  //lyrics space for next instrument
 
 
     int             m_musicxmlVersion;
@@ -257,9 +259,6 @@ protected:
 //    int m_nShowTupletBracket;
 //    int m_nShowTupletNumber;
 
-    //conversion from xml element name to int
-    std::map<std::string, int>	m_NameToEnum;
-
 public:
     MxlAnalyser(ostream& reporter, LibraryScope& libraryScope, Document* pDoc,
                 XmlParser* parser);
@@ -272,6 +271,10 @@ public:
     //analysis
     ImoObj* analyse_node(XmlNode* pNode, ImoObj* pAnchor=nullptr);
     void prepare_for_new_instrument_content();
+    int get_threads_for_parts();
+    bool parts_can_be_analysed_concurrently(vector<XmlNode>& parts);
+    void analyse_parts_concurrently(vector<XmlNode>& parts, ImoScore* pScore,
+                                    int numThreads);
 
     //part-list
     bool part_list_is_valid() { return m_partList.get_num_items() > 0; }
@@ -397,16 +400,23 @@ public:
     string get_element_info();
     inline void save_current_part_id(const string& id) { m_curPartId = id; }
     int get_line_number(XmlNode* node);
+    void release_node(XmlNode* node);
 
 
-    int name_to_enum(const string& name) const;
+    int name_to_enum(const char* name) const;
     bool to_integer(const string& text, int* pResult);
 
 
 protected:
-    MxlElementAnalyser* new_analyser(const string& name, ImoObj* pAnchor=nullptr);
+    void create_relation_builders();
     void delete_relation_builders();
     void add_marging_space_for_lyrics(ImoNote* pNote, ImoLyric* pLyric);
+    void add_marging_space_after(ImoInstrument* pInstr, LUnits space);
+    MxlAnalyser* new_part_worker(ostream& reporter, ImoScore* pScore);
+    void merge_part_worker(MxlAnalyser* pWorker, ImoInstrument* pInstr);
+    static void shift_relation_numbers(ImoInstrument* pInstr, int tieShift,
+                                       int slurShift);
+    static bool part_depends_on_previous_part(XmlNode& part);
 };
 
 //defined in WordsMxlAnalyser to simplify unit testing of the regex
@@ -44,6 +44,7 @@ class MxlAnalyser;
 class LibraryScope;
 class ImoDocument;
 class Document;
+class ZipInputStream;
 
 
 //---------------------------------------------------------------------------------------
@@ -67,6 +68,8 @@ public:
 
 protected:
     ImoDocument* compile_parsed_tree(XmlNode* root);
+    bool is_compressed_musicxml(const std::string& filename);
+    bool move_to_rootfile(ZipInputStream* zip);
 
 };
 
@@ -66,6 +66,7 @@ protected:
     int8u* m_pSaveBytes;                //the real buffer for the clean copy
     URect m_damagedRect;
     URect m_prevDamagedRect;
+    VRect m_drawnRect;                  //pixels covered by overlays applied to rendering buffer
     GmoObj* m_pHandlersOwner;           //object owning current defined handlers
 
 public:
@@ -87,7 +88,10 @@ public:
 
 protected:
     void save_rendering_buffer();
+    void restore_rendering_buffer();
     void expand_damaged_rectangle();
+    VRect screen_rectangle(const URect& rect, ScreenDrawer* pDrawer);
+    int bytes_per_pixel();
 
 
 };
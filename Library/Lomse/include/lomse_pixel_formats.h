@@ -83,6 +83,7 @@ enum EPixelFormat
     k_pix_format_argb64 = 19,    ///< A-R-G-B, native MAC format 
     k_pix_format_abgr64 = 20,    ///< A-B-G-R, one byte per color component 
     k_pix_format_bgra64 = 21,    ///< B-G-R-A, native win32 BMP format 
+    k_pix_format_bgra32_pre = 22,    ///< B-G-R-A, premultiplied alpha, native JUCE/Cairo/Direct2D format
 };
 
 
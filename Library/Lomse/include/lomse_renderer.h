@@ -82,6 +82,45 @@ typedef agg::pixfmt_rgba64      PixFormat_rgba64;
 typedef agg::pixfmt_argb64      PixFormat_argb64;
 typedef agg::pixfmt_abgr64      PixFormat_abgr64;
 typedef agg::pixfmt_bgra64      PixFormat_bgra64;
+typedef agg::pixfmt_bgra32_pre  PixFormat_bgra32_pre;
+
+//---------------------------------------------------------------------------------------
+// Colors are plain (non-premultiplied) RGBA everywhere in Lomse. Pixel formats using
+// premultiplied alpha expect colors already multiplied by alpha.
+template <typename PixFormat>
+struct PixFormatTraits
+{
+    enum { k_premultiplied = 0 };
+};
+
+template <>
+struct PixFormatTraits<PixFormat_bgra32_pre>
+{
+    enum { k_premultiplied = 1 };
+};
+
+//---------------------------------------------------------------------------------------
+// SpanPremultiplied: span generator adapter. Gradient and image span generators
+// produce plain colors; this multiplies them by alpha for premultiplied pixel formats.
+template <class SpanGenerator>
+class SpanPremultiplied
+{
+protected:
+    SpanGenerator& m_spanGen;
+
+public:
+    SpanPremultiplied(SpanGenerator& spanGen) : m_spanGen(spanGen) {}
+
+    void prepare() { m_spanGen.prepare(); }
+
+    template <class ColorT>
+    void generate(ColorT* span, int x, int y, unsigned len)
+    {
+        m_spanGen.generate(span, x, y, len);
+        for (; len; --len, ++span)
+            span->premultiply();
+    }
+};
 
 
 //---------------------------------------------------------------------------------------
@@ -236,7 +275,7 @@ public:
         m_rbuf.attach(buf.buf(), buf.width(), buf.height(), buf.stride());
         m_renBase.reset_clipping(true);
 
-        m_renBase.clear( to_rgba(bgcolor) );
+        m_renBase.clear( pixel_color(bgcolor) );
 
         reset();
         set_transformation();
@@ -297,10 +336,22 @@ public:
     //-----------------------------------------------------------------------------------
     void render(FontRasterizer& ras, FontScanline& sl, Color color)
     {
-        m_renSolid.color( to_rgba(color) );
+        m_renSolid.color( pixel_color(color) );
         agg::render_scanlines(ras, sl, m_renSolid);
     }
 
+    //-----------------------------------------------------------------------------------
+    // Converts a Lomse color to the color expected by the pixel format
+    rgba8 pixel_color(Color c, double opacity = 1.0)
+    {
+        rgba8 color = to_rgba(c);
+        if (opacity != 1.0)
+            color.opacity(color.opacity() * opacity);
+        if (PixFormatTraits<PixFormat>::k_premultiplied)
+            color.premultiply();
+        return color;
+    }
+
     //-----------------------------------------------------------------------------------
     // Expand all polygons
     void expand(double value) { m_curved_trans_contour.width(value); }
@@ -394,8 +445,7 @@ protected:
                     ras.add_path(m_curved_trans_contour, attr.path_index);
                 }
 
-                color = to_rgba(attr.fill_color);
-                color.opacity(color.opacity() * opacity);
+                color = pixel_color(attr.fill_color, opacity);
                 ren.color(color);
                 agg::render_scanlines(ras, sl, ren);
             }
@@ -438,15 +488,8 @@ protected:
                 typedef agg::span_allocator<agg::rgba8>   SpanAllocatorType;
                 SpanAllocatorType spanAllocator;
 
-                //define a renderer using the span allocator and the linear gradient span
-                typedef agg::renderer_scanline_aa<RendererBase,
-                                                  SpanAllocatorType,
-                                                  LinearGradientSpan> RendererLinearGradient;
-
-                RendererLinearGradient renderer(m_renBase, spanAllocator, span);
-
-                //procceed to render using defined renderer
-                agg::render_scanlines(ras, sl, renderer);
+                //procceed to render using the span allocator and the linear gradient span
+                render_spans(ras, sl, spanAllocator, span);
             }
 
             if(attr.stroke_flag)
@@ -469,14 +512,28 @@ protected:
                 ras.reset();
                 ras.filling_rule(fill_non_zero);
                 ras.add_path(m_curved_stroked_trans, attr.path_index);
-                color = to_rgba(attr.stroke_color);
-                color.opacity(color.opacity() * opacity);
+                color = pixel_color(attr.stroke_color, opacity);
                 ren.color(color);
                 agg::render_scanlines(ras, sl, ren);
             }
         }
     }
 
+    //-----------------------------------------------------------------------------------
+    // Render scanlines with colors from a span generator (gradients and images)
+    template<class Rasterizer, class Scanline, class SpanAllocator, class SpanGenerator>
+    void render_spans(Rasterizer& ras, Scanline& sl, SpanAllocator& sa,
+                      SpanGenerator& sg)
+    {
+        if (PixFormatTraits<PixFormat>::k_premultiplied)
+        {
+            SpanPremultiplied<SpanGenerator> sgPre(sg);
+            agg::render_scanlines_aa(ras, sl, m_renBase, sa, sgPre);
+        }
+        else
+            agg::render_scanlines_aa(ras, sl, m_renBase, sa, sg);
+    }
+
     //-----------------------------------------------------------------------------------
     // Render a bitmap.
     template<class Renderer, bool hasAlpha>
@@ -538,7 +595,7 @@ protected:
 		        typedef agg::span_image_filter_rgba_nn<img_accessor_type,
                                                     InterpolatorType> span_gen_type;
                 span_gen_type sg(source, interpolator);
-                agg::render_scanlines_aa(ras, sl, m_renBase, sa, sg);
+                render_spans(ras, sl, sa, sg);
             }
 
             else if (quality == k_quality_medium)
@@ -547,7 +604,7 @@ protected:
 		        typedef agg::span_image_filter_rgba_bilinear<img_accessor_type,
                                                     InterpolatorType> span_gen_type;
                 span_gen_type sg(source, interpolator);
-                agg::render_scanlines_aa(ras, sl, m_renBase, sa, sg);
+                render_spans(ras, sl, sa, sg);
             }
 
         #else  //bitmap without alpha channel: use rgb filter
@@ -558,7 +615,7 @@ protected:
 		        typedef agg::span_image_filter_rgb_nn<img_accessor_type,
                                                     InterpolatorType> span_gen_type;
                 span_gen_type sg(source, interpolator);
-                agg::render_scanlines_aa(ras, sl, m_renBase, sa, sg);
+                render_spans(ras, sl, sa, sg);
             }
             else if (quality == k_quality_medium)
             {
@@ -566,7 +623,7 @@ protected:
 		        typedef agg::span_image_filter_rgb_bilinear<img_accessor_type,
                                                     InterpolatorType> span_gen_type;
                 span_gen_type sg(source, interpolator);
-                agg::render_scanlines_aa(ras, sl, m_renBase, sa, sg);
+                render_spans(ras, sl, sa, sg);
             }
         #endif
 
@@ -33,6 +33,7 @@
 #include <vector>
 #include <ostream>
 #include <map>
+#include <unordered_map>
 #include "lomse_document.h"
 #include "lomse_time.h"
 
@@ -53,6 +54,8 @@ class ImoScore;
 class ImoTimeSignature;
 class ImoGoBackFwd;
 class ImoMusicData;
+class ColStaffObjs;
+class ColStaffObjsIndex;
 
 
 //---------------------------------------------------------------------------------------
@@ -65,20 +68,20 @@ protected:
     int                 m_instr;
     int                 m_line;
     int                 m_staff;
+    int                 m_order;    //arrival order in the instrument
     ImoStaffObj*        m_pImo;
-
-    ColStaffObjsEntry*  m_pNext;    //next entry in the collection
-    ColStaffObjsEntry*  m_pPrev;    //prev. entry in the collection
+    ColStaffObjs*       m_pOwner;   //table containing this entry
 
 public:
-    ColStaffObjsEntry(int measure, int instr, int line, int staff, ImoStaffObj* pImo)
+    ColStaffObjsEntry(int measure, int instr, int line, int staff, ImoStaffObj* pImo,
+                      ColStaffObjs* pOwner, int order=0)
         : m_measure(measure)
         , m_instr(instr)
         , m_line(line)
         , m_staff(staff)
+        , m_order(order)
         , m_pImo(pImo)
-        , m_pNext(nullptr)
-        , m_pPrev(nullptr)
+        , m_pOwner(pOwner)
     {
     }
 
@@ -103,48 +106,108 @@ public:
     std::string to_string_with_ids();
 
     //list structure
-    inline ColStaffObjsEntry* get_next() { return m_pNext; }
-    inline ColStaffObjsEntry* get_prev() { return m_pPrev; }
+    inline ColStaffObjsEntry* get_next();
+    inline ColStaffObjsEntry* get_prev();
 
 protected:
     friend class ColStaffObjs;
-    inline void set_next(ColStaffObjsEntry* pEntry) { m_pNext = pEntry; }
-    inline void set_prev(ColStaffObjsEntry* pEntry) { m_pPrev = pEntry; }
 
+};
+
+
+//---------------------------------------------------------------------------------------
+// StaffVoiceLineTable: algorithm assign line number to voices/staves
+//---------------------------------------------------------------------------------------
+class StaffVoiceLineTable
+{
+protected:
+    int                 m_lastAssignedLine;
+    std::map<int, int>  m_lineForStaffVoice;    //key = 100*staff + voice
+    std::vector<int>    m_firstVoiceForStaff;   //key = staff
+
+public:
+    StaffVoiceLineTable();
+
+    int get_line_assigned_to(int nVoice, int nStaff);
+    void new_instrument();
+    inline int get_number_of_lines() { return m_lastAssignedLine; }
+    inline int num_assigned() { return int(m_lineForStaffVoice.size()); }
+
+private:
+    int assign_line_to(int nVoice, int nStaff);
+    inline int form_key(int nVoice, int nStaff) { return 100 * nStaff + nVoice; }
 
 };
 
 
 //---------------------------------------------------------------------------------------
-// ColStaffObjs: encapsulates the staff objects collection for a score
+// ColStaffObjsMeasureInfo: state of the builder algorithm when a measure starts in an
+// instrument. It is saved in the table for rebuilding only the measures affected by
+// localized changes.
+//---------------------------------------------------------------------------------------
+struct ColStaffObjsMeasureInfo
+{
+    ImoStaffObj*    pBarline;           //barline ending previous measure, or nullptr
+    TimeUnits       curTime;
+    TimeUnits       maxSegmentTime;
+    TimeUnits       startSegmentTime;
+    int             curVoice;
+    int             order;              //arrival order of first entry in the measure
+
+    //measure content, known when the measure ends
+    TimeUnits       minTime;            //time range of the entries in the measure
+    TimeUnits       maxTime;
+    TimeUnits       minNoteDuration;    //shortest note/rest in the measure
+    bool            fSignatures;        //it contains key or time signatures
+};
+
+//---------------------------------------------------------------------------------------
+// ColStaffObjsInstrInfo: builder data for an instrument, saved in the table
 //---------------------------------------------------------------------------------------
+struct ColStaffObjsInstrInfo
+{
+    std::vector<ColStaffObjsMeasureInfo> measures;
+    StaffVoiceLineTable lines;      //lines assigned when the instrument was processed
+    int lastNewLineMeasure;         //last measure in which a line was assigned
+};
+
 
-//typedef  vector<ColStaffObjsEntry*>::iterator      ColStaffObjsIterator;
+//---------------------------------------------------------------------------------------
+// ColStaffObjs: encapsulates the staff objects collection for a score
+//
+// Entries are stored by value in a single array, in table order. New entries are
+// appended and merged into place in one pass before the table is next accessed.
+// AWARE: Adding or deleting entries invalidates pointers to entries and iterators.
+//---------------------------------------------------------------------------------------
 
 class ColStaffObjs
 {
 protected:
     int m_numLines;
-    int m_numEntries;
+    int m_numSorted;        //entries [0, m_numSorted) are in table order
     TimeUnits m_rMissingTime;
     TimeUnits m_minNoteDuration;
 
-    ColStaffObjsEntry* m_pFirst;
-    ColStaffObjsEntry* m_pLast;
+    std::vector<ColStaffObjsEntry> m_entries;
+    ColStaffObjsIndex* m_pIndex;    //for searches. Built on demand
+
+    //builder data, per instrument, for updating the table after localized changes
+    std::vector<ColStaffObjsInstrInfo> m_instrInfo;
 
 public:
     ColStaffObjs();
     ~ColStaffObjs();
 
     //table info
-    inline int num_entries() { return m_numEntries; }
+    inline int num_entries() { return int(m_entries.size()); }
     inline int num_lines() { return m_numLines; }
     inline bool is_anacrusis_start() { return is_greater_time(m_rMissingTime, 0.0); }
     inline TimeUnits anacrusis_missing_time() { return m_rMissingTime; }
     inline TimeUnits min_note_duration() { return m_minNoteDuration; }
 
     //table management
-    void add_entry(int measure, int instr, int voice, int staff, ImoStaffObj* pImo);
+    void add_entry(int measure, int instr, int voice, int staff, ImoStaffObj* pImo,
+                   int order=0);
     void delete_entry_for(ImoStaffObj* pSO);
 
     //iterator related
@@ -219,17 +282,32 @@ public:
             }
     };
 
-	inline iterator begin() { return iterator(m_pFirst); }
+	inline iterator begin() { return iterator(front()); }
 	inline iterator end() { return iterator(nullptr); }
-    inline ColStaffObjsEntry* back() { return m_pLast; }
-    inline ColStaffObjsEntry* front() { return m_pFirst; }
+    inline ColStaffObjsEntry* back() {
+        ensure_sorted();
+        return m_entries.empty() ? nullptr : &m_entries.back();
+    }
+    inline ColStaffObjsEntry* front() {
+        ensure_sorted();
+        return m_entries.empty() ? nullptr : &m_entries.front();
+    }
     inline iterator find(ImoStaffObj* pSO) { return iterator(find_entry_for(pSO)); }
 
+    //indexed searches
+    ColStaffObjsEntry* next_noterest_in_voice(ColStaffObjsEntry* pEntry);
+    ColStaffObjsEntry* find_noterest_sounding_at(int instr, int voice, TimeUnits time);
+    ColStaffObjsEntry* find_noterest_ending_after(int instr, int voice, TimeUnits time);
+    ColStaffObjsEntry* find_last_barline_not_after(TimeUnits time);
+
     //debug
     string dump(bool fWithIds=true);
+    string dump_builder_data();
 
 protected:
 
+    friend class ColStaffObjsEntry;
+    friend class ColStaffObjsIndex;
     friend class ColStaffObjsBuilder;
     friend class ColStaffObjsBuilderEngine;
     friend class ColStaffObjsBuilderEngine1x;
@@ -237,38 +315,84 @@ protected:
 
     inline void set_total_lines(int number) { m_numLines = number; }
     inline void set_anacrusis_missing_time(TimeUnits rTime) { m_rMissingTime = rTime; }
+    //entry pending to be placed in the table, for sort_table()
+    struct SortKey
+    {
+        TimeUnits time;
+        int index;
+    };
+
     void sort_table();
+    inline void ensure_sorted() {
+        if (m_numSorted < int(m_entries.size()))
+            sort_table();
+    }
+    static void merge_entries(std::vector<ColStaffObjsEntry>& entries, int numSorted);
     static bool is_lower_entry(ColStaffObjsEntry* b, ColStaffObjsEntry* a);
+    static bool is_lower_key(const SortKey& a, const SortKey& b);
+    static bool is_lower_arrival(const ColStaffObjsEntry& a, const ColStaffObjsEntry& b);
+    int replace_entries(int instr, int firstMeasure, int endMeasure, int measureShift,
+                        int orderShift, TimeUnits minTime, TimeUnits maxTime,
+                        int* pEnd);
     inline void set_min_note(TimeUnits duration) { m_minNoteDuration = duration; }
 
-    void add_entry_to_list(ColStaffObjsEntry* pEntry);
     ColStaffObjsEntry* find_entry_for(ImoStaffObj* pSO);
+    ColStaffObjsIndex* get_index();
+    void invalidate_index();
 
 };
 
 typedef  ColStaffObjs::iterator      ColStaffObjsIterator;
 
+//---------------------------------------------------------------------------------------
+inline ColStaffObjsEntry* ColStaffObjsEntry::get_next()
+{
+    ColStaffObjsEntry* pLast = &m_pOwner->m_entries.back();
+    return (this < pLast ? this + 1 : nullptr);
+}
 
 //---------------------------------------------------------------------------------------
-// StaffVoiceLineTable: algorithm assign line number to voices/staves
+inline ColStaffObjsEntry* ColStaffObjsEntry::get_prev()
+{
+    ColStaffObjsEntry* pFirst = &m_pOwner->m_entries.front();
+    return (this > pFirst ? this - 1 : nullptr);
+}
+
+
 //---------------------------------------------------------------------------------------
-class StaffVoiceLineTable
+// ColStaffObjsIndex: lookup structures for searching a ColStaffObjs table without
+// traversing it. Positions are indexes in the table. The table discards the index
+// when entries are added or deleted and builds a new one on next search.
+//---------------------------------------------------------------------------------------
+class ColStaffObjsIndex
 {
 protected:
-    int                 m_lastAssignedLine;
-    std::map<int, int>  m_lineForStaffVoice;    //key = 100*staff + voice
-    std::vector<int>    m_firstVoiceForStaff;   //key = staff
+    //a note/rest or barline, in table order
+    struct TimedEntry
+    {
+        TimeUnits time;
+        TimeUnits maxEnd;   //for notes/rests: max. end time of this and previous ones
+        int       pos;
+    };
+
+    typedef std::pair<int, int>  VoiceKey;      //instrument, voice
+
+    std::unordered_map<ImoStaffObj*, int> m_posForImo;  //first entry for each object
+    std::map<VoiceKey, std::vector<TimedEntry> > m_voices;
+    std::vector<int> m_posInVoice;          //for each entry: index in its voice, or -1
+    std::vector<TimedEntry> m_barlines;
 
 public:
-    StaffVoiceLineTable();
+    ColStaffObjsIndex(ColStaffObjs* pColStaffObjs);
 
-    int get_line_assigned_to(int nVoice, int nStaff);
-    void new_instrument();
-    inline int get_number_of_lines() { return m_lastAssignedLine; }
+    int find_pos_for(ImoStaffObj* pSO) const;
+    int next_noterest_in_voice(int pos, int instr, int voice) const;
+    int find_noterest_sounding_at(int instr, int voice, TimeUnits time) const;
+    int find_noterest_ending_after(int instr, int voice, TimeUnits time) const;
+    int find_last_barline_not_after(TimeUnits time) const;
 
-private:
-    int assign_line_to(int nVoice, int nStaff);
-    inline int form_key(int nVoice, int nStaff) { return 100 * nStaff + nVoice; }
+protected:
+    const std::vector<TimedEntry>* get_voice(int instr, int voice) const;
 
 };
 
@@ -280,11 +404,28 @@ class ColStaffObjsBuilderEngine;
 
 class ColStaffObjsBuilder
 {
+protected:
+    //info about the last update()
+    ColStaffObjsEntry* m_pFirstUpdated;     //first entry in the rebuilt range
+    ColStaffObjsEntry* m_pLastUpdated;      //last entry in the rebuilt range
+    bool m_fSignaturesUpdated;              //key or time signatures in rebuilt measures
+
 public:
-    ColStaffObjsBuilder() {}
+    ColStaffObjsBuilder()
+        : m_pFirstUpdated(nullptr)
+        , m_pLastUpdated(nullptr)
+        , m_fSignaturesUpdated(false)
+    {
+    }
     virtual ~ColStaffObjsBuilder() {}
 
     ColStaffObjs* build(ImoScore* pScore);
+    bool update(ImoScore* pScore, int iInstr, int firstMeasure, int lastMeasure);
+
+    //info about the last update()
+    inline ColStaffObjsEntry* first_updated_entry() { return m_pFirstUpdated; }
+    inline ColStaffObjsEntry* last_updated_entry() { return m_pLastUpdated; }
+    inline bool signatures_updated() { return m_fSignaturesUpdated; }
 
 protected:
     ColStaffObjsBuilderEngine* create_builder_engine(ImoScore* pScore);
@@ -301,37 +442,67 @@ protected:
     ImoScore* m_pImScore;
 
     int         m_nCurMeasure;
+    int         m_nCurOrder;            //arrival order for next entry
     TimeUnits   m_rMaxSegmentTime;
     TimeUnits   m_rStartSegmentTime;
     TimeUnits   m_minNoteDuration;
     StaffVoiceLineTable  m_lines;
+    int         m_lastNewLineMeasure;   //last measure in which a line was assigned
+    std::vector<ColStaffObjsMeasureInfo>* m_pMeasures;  //info for current instrument
+
+    //result of do_update()
+    int         m_firstUpdated;         //table position of first rebuilt entry
+    int         m_endUpdated;           //table position after last rebuilt entry
+    bool        m_fSignaturesUpdated;
 
     ColStaffObjsBuilderEngine(ImoScore* pScore)
         : m_pColStaffObjs(nullptr)
         , m_pImScore(pScore)
         , m_nCurMeasure(0)
+        , m_nCurOrder(0)
         , m_rMaxSegmentTime(0.0)
         , m_rStartSegmentTime(0.0)
         , m_minNoteDuration(LOMSE_NO_NOTE_DURATION)
+        , m_lastNewLineMeasure(-1)
+        , m_pMeasures(nullptr)
+        , m_firstUpdated(0)
+        , m_endUpdated(0)
+        , m_fSignaturesUpdated(false)
     {}
 
 public:
     virtual ~ColStaffObjsBuilderEngine() {}
 
     ColStaffObjs* do_build();
+    bool do_update(ColStaffObjs* pColStaffObjs, int nInstr, int firstMeasure,
+                   int lastMeasure);
+
+    //result of do_update()
+    inline int first_updated() { return m_firstUpdated; }
+    inline int end_updated() { return m_endUpdated; }
+    inline bool signatures_updated() { return m_fSignaturesUpdated; }
 
 protected:
     virtual void initializations()=0;
     virtual void determine_timepos(ImoStaffObj* pSO)=0;
-    virtual void create_entries(int nInstr)=0;
+    virtual void reset_counters()=0;
+    virtual void add_entries_for(ImoObj* pImo, int nInstr)=0;
     virtual void prepare_for_next_instrument()=0;
+    virtual void save_state(ColStaffObjsMeasureInfo& info)=0;
+    virtual void restore_state(const ColStaffObjsMeasureInfo& info)=0;
 
     void create_table();
+    void create_entries(int nInstr);
     void collect_anacrusis_info();
     int get_line_for(int nVoice, int nStaff);
     void set_num_lines();
     void add_entries_for_key_or_time_signature(ImoObj* pImo, int nInstr);
+    void add_entry(int nInstr, int nLine, int nStaff, ImoStaffObj* pSO);
+    void update_min_note_duration(TimeUnits duration);
     void set_min_note_duration();
+    void start_measure(ImoStaffObj* pBarline);
+    static bool is_same_state(const ColStaffObjsMeasureInfo& a,
+                              const ColStaffObjsMeasureInfo& b);
 
 };
 
@@ -358,7 +529,7 @@ private:
     TimeUnits   m_rCurTime;
 
     void initializations();
-    void create_entries(int nInstr);
+    void add_entries_for(ImoObj* pImo, int nInstr);
     void reset_counters();
     void determine_timepos(ImoStaffObj* pSO);
     void update_measure(ImoStaffObj* pSO);
@@ -367,6 +538,8 @@ private:
     ImoDirection* anchor_object(ImoAuxObj* pImo);
     void delete_node(ImoGoBackFwd* pGBF, ImoMusicData* pMusicData);
     void prepare_for_next_instrument();
+    void save_state(ColStaffObjsMeasureInfo& info);
+    void restore_state(const ColStaffObjsMeasureInfo& info);
 
 };
 
@@ -393,12 +566,14 @@ public:
 
 private:
     void initializations();
-    void create_entries(int nInstr);
+    void add_entries_for(ImoObj* pImo, int nInstr);
     void reset_counters();
     void determine_timepos(ImoStaffObj* pSO);
-    void update_measure();
+    void update_measure(ImoStaffObj* pSO);
     void add_entry_for_staffobj(ImoObj* pImo, int nInstr);
     void prepare_for_next_instrument();
+    void save_state(ColStaffObjsMeasureInfo& info);
+    void restore_state(const ColStaffObjsMeasureInfo& info);
 
 };
 
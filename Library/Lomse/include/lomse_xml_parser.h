@@ -34,6 +34,7 @@
 #include "lomse_internal_model.h"
 
 #include <string>
+#include <mutex>
 using namespace std;
 
 #include "pugixml/pugiconfig.hpp"
@@ -45,6 +46,8 @@ namespace lomse
 {
 
 //forward declarations and definitions
+class MappedFile;
+class InputStream;
 typedef pugi::xml_document          XmlDocument;
 typedef pugi::xml_attribute         XmlAttribute;
 
@@ -64,6 +67,7 @@ public:
     XmlNode(const XmlNode* node) : m_node(node->m_node) {}
 
     string name() { return string(m_node.name()); }
+    inline const char* c_name() { return m_node.name(); }   //no copy, pointer to parser buffer
     string value();
     XmlAttribute attribute(const string& name) {
         return m_node.attribute(name.c_str());
@@ -122,15 +126,26 @@ private:
     vector<ptrdiff_t> m_offsetData;     // offset -> line mapping
     bool m_fOffsetDataReady;
     string m_filename;
+    MappedFile* m_pMappedFile;          //file being parsed in place, or nullptr
+    std::mutex m_offsetMutex;           //line numbers can be requested from analysis threads
 
 public:
     XmlParser(ostream& reporter=cout);
     ~XmlParser();
 
     void parse_file(const std::string& filename, bool fErrorMsg = true);
+    void parse_mapped_file(const std::string& filename);
+    void parse_input_stream(InputStream* pFile, size_t size);
     void parse_text(const std::string& sourceText);
     void parse_cstring(char* sourceText);
 
+    //remove an already analysed node from the tree, to reduce memory usage
+    void release_node(XmlNode* node);
+
+    //discard the tree, i.e. when it is not the expected document
+    void clear();
+    void report_error(const string& msg);
+
     inline const string& get_error() { return m_errorMsg; }
     inline const string& get_encoding() { return m_encoding; }
     inline XmlNode* get_tree_root() { return &m_root; }
@@ -138,8 +153,10 @@ public:
 
 protected:
     void parse_char_string(char* string);
+    void close_mapped_file();
     void find_root();
-    bool build_offset_data(const char* file);
+    bool build_offset_data(const string& filename);
+    void build_offset_data(const char* text, size_t size);
     std::pair<int, int> get_location(ptrdiff_t offset);
 
 };
@@ -561,6 +561,20 @@ int CmdAddChordNote::perform_action(Document* pDoc, DocCursor* pCursor)
     pNewNote->set_notated_pitch(m_step, m_octave, m_accidentals);
     m_noteId = pNewNote->get_id();
 
+    //get measure to update. The new note is in the same measure than base note
+    ColStaffObjs* pTable = pScore->get_staffobjs_table();
+    int iInstr = -1;
+    int measure = 0;
+    if (pTable)
+    {
+        ColStaffObjsIterator itCSO = pTable->find(pBaseNote);
+        if (itCSO != pTable->end())
+        {
+            iInstr = (*itCSO)->num_instrument();
+            measure = (*itCSO)->measure();
+        }
+    }
+
     //add new note to Imo tree
     pInstr->insert_staffobj_after(pBaseNote, pNewNote);
 
@@ -568,7 +582,10 @@ int CmdAddChordNote::perform_action(Document* pDoc, DocCursor* pCursor)
     ImoTreeAlgoritms::add_note_to_chord(pBaseNote, pNewNote, pDoc);
 
     //force to rebuild ColStaffObjs table
-    pScore->end_of_changes();
+    if (iInstr == -1)
+        pScore->end_of_changes();
+    else
+        pScore->end_of_changes(iInstr, measure, measure);
 
     return k_success;
 }
@@ -1543,7 +1560,7 @@ int CmdChangeDots::perform_action(Document* pDoc, DocCursor* pCursor)
     //rebuild StaffObjs collection, as duration of some objects have changed and this
     //affects to timepos of objects after them
     ImoScore* pScore = static_cast<ImoScore*>( pCursor->get_parent_object() );
-    pScore->end_of_changes();
+    update_score(pDoc, pScore);
 
     return k_success;
 }
@@ -1562,7 +1579,47 @@ void CmdChangeDots::undo_action(Document* pDoc, DocCursor* pCursor)
 
     //rebuild StaffObjs collection
     ImoScore* pScore = static_cast<ImoScore*>( pCursor->get_parent_object() );
-    pScore->end_of_changes();
+    update_score(pDoc, pScore);
+}
+
+//---------------------------------------------------------------------------------------
+void CmdChangeDots::update_score(Document* pDoc, ImoScore* pScore)
+{
+    //Changing dots does not change measures. Therefore, when all notes/rests belong
+    //to the same instrument, the StaffObjs collection is updated only from the first
+    //affected measure, using the entries for the notes/rests in current collection.
+
+    ColStaffObjs* pTable = pScore->get_staffobjs_table();
+    int iInstr = -1;
+    int firstMeasure = 0;
+    int lastMeasure = 0;
+    list<ImoId>::iterator it;
+    for (it = m_noteRests.begin(); pTable && it != m_noteRests.end(); ++it)
+    {
+        ImoNoteRest* pNR = static_cast<ImoNoteRest*>( pDoc->get_pointer_to_imo(*it) );
+        ColStaffObjsIterator itCSO = pTable->find(pNR);
+        if (itCSO == pTable->end()
+            || (iInstr != -1 && (*itCSO)->num_instrument() != iInstr))
+        {
+            iInstr = -1;
+            break;
+        }
+
+        int measure = (*itCSO)->measure();
+        if (iInstr == -1)
+        {
+            iInstr = (*itCSO)->num_instrument();
+            firstMeasure = measure;
+            lastMeasure = measure;
+        }
+        firstMeasure = min(firstMeasure, measure);
+        lastMeasure = max(lastMeasure, measure);
+    }
+
+    if (iInstr == -1)
+        pScore->end_of_changes();
+    else
+        pScore->end_of_changes(iInstr, firstMeasure, lastMeasure);
 }
 
 
@@ -2175,6 +2232,23 @@ int CmdDeleteStaffObj::perform_action(Document* pDoc, DocCursor* pCursor)
             }
         }
 
+        //get measures to update. When deleting a barline, its measure is merged
+        //with next one
+        ImoScore* pScore = static_cast<ImoScore*>( pCursor->get_parent_object() );
+        ColStaffObjs* pTable = pScore->get_staffobjs_table();
+        int iInstr = -1;
+        int measure = 0;
+        if (pTable)
+        {
+            ColStaffObjsIterator itCSO = pTable->find(pImo);
+            if (itCSO != pTable->end())
+            {
+                iInstr = (*itCSO)->num_instrument();
+                measure = (*itCSO)->measure();
+            }
+        }
+        int lastMeasure = (pImo->is_barline() ? measure + 1 : measure);
+
         //delete object
         ImoInstrument* pInstr = pImo->get_instrument();
         pInstr->delete_staffobj(pImo);
@@ -2192,8 +2266,10 @@ int CmdDeleteStaffObj::perform_action(Document* pDoc, DocCursor* pCursor)
         }
 
         //rebuild StaffObjs collection
-        ImoScore* pScore = static_cast<ImoScore*>( pCursor->get_parent_object() );
-        pScore->end_of_changes();
+        if (iInstr == -1)
+            pScore->end_of_changes();
+        else
+            pScore->end_of_changes(iInstr, measure, lastMeasure);
 
         return k_success;
     }
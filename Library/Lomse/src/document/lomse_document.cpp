@@ -40,6 +40,7 @@
 #include "lomse_mnx_compiler.h"
 #include "lomse_injectors.h"
 #include "lomse_id_assigner.h"
+#include "lomse_im_arena.h"
 #include "lomse_internal_model.h"
 #include "lomse_ldp_exporter.h"
 #include "lomse_lmd_exporter.h"
@@ -147,12 +148,15 @@ Document::Document(LibraryScope& libraryScope, ostream& reporter)
     , m_reporter(reporter)
     , m_docScope(reporter)
     , m_pIdAssigner( m_docScope.id_assigner() )
+    , m_pArena(nullptr)
     , m_pImoDoc(nullptr)
     , m_flags(k_dirty)
     , m_modified(0)
     , m_beatType(k_beat_implied)
     , m_beatDuration( TimeUnits(k_duration_quarter) )
 {
+    if (libraryScope.use_imo_arena())
+        m_pArena = LOMSE_NEW ImoArena();
 }
 
 //---------------------------------------------------------------------------------------
@@ -160,6 +164,8 @@ Document::~Document()
 {
     delete m_pImoDoc;
     delete_observers();
+    if (m_pArena)
+        m_pArena->release();
 }
 
 //---------------------------------------------------------------------------------------
@@ -692,6 +698,28 @@ void Document::on_removed_from_model(ImoObj* pImo)
     m_pIdAssigner->remove(pImo);
 }
 
+//---------------------------------------------------------------------------------------
+void Document::begin_concurrent_building()
+{
+    m_pIdAssigner->begin_concurrent_assignment();
+    if (m_pArena)
+        m_pArena->set_concurrent(true);
+}
+
+//---------------------------------------------------------------------------------------
+void Document::log_ids_assigned_by_this_thread(vector<ImoId>* pLog)
+{
+    m_pIdAssigner->log_ids_assigned_by_this_thread(pLog);
+}
+
+//---------------------------------------------------------------------------------------
+void Document::end_concurrent_building(const vector< vector<ImoId> >& logs)
+{
+    if (m_pArena)
+        m_pArena->set_concurrent(false);
+    m_pIdAssigner->end_concurrent_assignment(logs);
+}
+
 //---------------------------------------------------------------------------------------
 ImoObj* Document::get_pointer_to_imo(ImoId id) const
 {
@@ -39,15 +39,21 @@ using namespace std;
 namespace lomse
 {
 
+//ids assigned by current thread while in concurrent mode, or nullptr
+static thread_local vector<ImoId>* t_pIdsLog = nullptr;
+
 //---------------------------------------------------------------------------------------
 IdAssigner::IdAssigner()
     : m_idCounter(k_no_imoid)
+    , m_fConcurrent(false)
+    , m_idBase(k_no_imoid)
 {
 }
 
 //---------------------------------------------------------------------------------------
 void IdAssigner::reset()
 {
+    //the document is going to be reloaded: release the table, not just empty it
     m_idToImo.clear();
     m_idCounter = k_no_imoid;
 }
@@ -55,22 +61,29 @@ void IdAssigner::reset()
 //---------------------------------------------------------------------------------------
 void IdAssigner::assign_id(ImoObj* pImo)
 {
+    std::unique_lock<std::mutex> lock = lock_if_concurrent();
+
     ImoId id = pImo->get_id();
     if (id == k_no_imoid)
     {
         pImo->set_id(++m_idCounter);
-        m_idToImo[m_idCounter] = pImo;
+        m_idToImo.set(m_idCounter, pImo);
     }
     else
     {
-        m_idToImo[id] = pImo;
+        m_idToImo.set(id, pImo);
         m_idCounter = max(id, m_idCounter);
     }
+
+    if (t_pIdsLog)
+        t_pIdsLog->push_back(pImo->get_id());
 }
 
 //---------------------------------------------------------------------------------------
 ImoId IdAssigner::reserve_id(ImoId id)
 {
+    std::unique_lock<std::mutex> lock = lock_if_concurrent();
+
     if (id == k_no_imoid)
     {
         return ++m_idCounter;
@@ -91,12 +104,14 @@ void IdAssigner::assign_id(Control* pControl)
     else
         m_idCounter = max(id, m_idCounter);
 
-    m_idToControl[m_idCounter] = pControl;
+    m_idToControl.set(m_idCounter, pControl);
 }
 
 //---------------------------------------------------------------------------------------
 void IdAssigner::remove(ImoObj* pImo)
 {
+    std::unique_lock<std::mutex> lock = lock_if_concurrent();
+
     ImoId id = pImo->get_id();
     if (id != k_no_imoid)
     {
@@ -108,21 +123,15 @@ void IdAssigner::remove(ImoObj* pImo)
 //---------------------------------------------------------------------------------------
 ImoObj* IdAssigner::get_pointer_to_imo(ImoId id) const
 {
-	map<ImoId, ImoObj*>::const_iterator it = m_idToImo.find( id );
-	if (it != m_idToImo.end())
-		return it->second;
-    else
-      return nullptr;
+    std::unique_lock<std::mutex> lock = lock_if_concurrent();
+
+    return m_idToImo.get(id);
 }
 
 //---------------------------------------------------------------------------------------
 Control* IdAssigner::get_pointer_to_control(ImoId id) const
 {
-	map<ImoId, Control*>::const_iterator it = m_idToControl.find( id );
-	if (it != m_idToControl.end())
-		return it->second;
-    else
-      return nullptr;
+    return m_idToControl.get(id);
 }
 
 //---------------------------------------------------------------------------------------
@@ -130,17 +139,19 @@ string IdAssigner::dump() const
 {
     stringstream data;
     data << "Imo: " << endl;
-	map<ImoId, ImoObj*>::const_iterator it;
-	for (it = m_idToImo.begin(); it != m_idToImo.end(); ++it)
-		data << it->first << "-" << it->second->get_name() << endl;
+    ImoId id;
+    for (id = m_idToImo.next_id(k_no_imoid); id != k_no_imoid; id = m_idToImo.next_id(id))
+        data << id << "-" << m_idToImo.get(id)->get_name() << endl;
     data << endl;
 
-	map<ImoId, Control*>::const_iterator itC = m_idToControl.begin();
-	if (itC != m_idToControl.end())
+    if (!m_idToControl.empty())
     {
         data << "Control: " << endl;
-        for (; itC != m_idToControl.end(); ++itC)
-            data << itC->first << endl;
+        for (id = m_idToControl.next_id(k_no_imoid); id != k_no_imoid;
+             id = m_idToControl.next_id(id))
+        {
+            data << id << endl;
+        }
     }
 
     return data.str();
@@ -149,28 +160,94 @@ string IdAssigner::dump() const
 //---------------------------------------------------------------------------------------
 void IdAssigner::copy_ids_to(IdAssigner* assigner, ImoId idMin)
 {
-	map<ImoId, ImoObj*>::const_iterator it;
-	for (it = m_idToImo.begin(); it != m_idToImo.end(); ++it)
+    ImoId id;
+    for (id = m_idToImo.next_id(idMin - 1); id != k_no_imoid; id = m_idToImo.next_id(id))
+        assigner->add_id(id, m_idToImo.get(id));
+
+    for (id = m_idToControl.next_id(k_no_imoid); id != k_no_imoid;
+         id = m_idToControl.next_id(id))
+    {
+        assigner->add_control_id(id, m_idToControl.get(id));
+    }
+}
+
+//---------------------------------------------------------------------------------------
+void IdAssigner::begin_concurrent_assignment()
+{
+    m_idBase = m_idCounter;
+    m_fConcurrent = true;
+}
+
+//---------------------------------------------------------------------------------------
+void IdAssigner::log_ids_assigned_by_this_thread(vector<ImoId>* pLog)
+{
+    t_pIdsLog = pLog;
+}
+
+//---------------------------------------------------------------------------------------
+void IdAssigner::end_concurrent_assignment(const vector< vector<ImoId> >& logs)
+{
+    //While concurrent, ids were taken in the order in which threads happened to run.
+    //Renumber them following the order of the logs, so that the ids in the model
+    //do not depend on threads timing. Objects deleted in the meantime are no longer
+    //in the map and are skipped.
+
+    m_fConcurrent = false;
+
+    IdTable<ImoObj> pending;
+    ImoId id;
+    for (id = m_idToImo.next_id(m_idBase); id != k_no_imoid; id = m_idToImo.next_id(id))
+    {
+        pending.set(id, m_idToImo.get(id));
+        m_idToImo.erase(id);
+    }
+    m_idCounter = m_idBase;
+
+    vector< vector<ImoId> >::const_iterator itLog;
+    for (itLog = logs.begin(); itLog != logs.end(); ++itLog)
     {
-        if (it->first >= idMin)
-            assigner->add_id(it->first, it->second);
+        vector<ImoId>::const_iterator itId;
+        for (itId = itLog->begin(); itId != itLog->end(); ++itId)
+        {
+            ImoObj* pImo = pending.get(*itId);
+            if (pImo)
+            {
+                pImo->set_id(++m_idCounter);
+                m_idToImo.set(m_idCounter, pImo);
+                pending.erase(*itId);
+            }
+        }
     }
 
-	map<ImoId, Control*>::const_iterator itC;
-	for (itC = m_idToControl.begin(); itC != m_idToControl.end(); ++itC)
-        assigner->add_control_id(itC->first, itC->second);
+    //objects not created by any logged thread
+    for (id = pending.next_id(k_no_imoid); id != k_no_imoid; id = pending.next_id(id))
+    {
+        ImoObj* pImo = pending.get(id);
+        pImo->set_id(++m_idCounter);
+        m_idToImo.set(m_idCounter, pImo);
+    }
+    m_idToImo.compact();
+}
+
+//---------------------------------------------------------------------------------------
+std::unique_lock<std::mutex> IdAssigner::lock_if_concurrent() const
+{
+    std::unique_lock<std::mutex> lock(m_mutex, std::defer_lock);
+    if (m_fConcurrent)
+        lock.lock();
+    return lock;
 }
 
 //---------------------------------------------------------------------------------------
 void IdAssigner::add_id(ImoId id, ImoObj* pImo)
 {
-    m_idToImo[id] = pImo;
+    m_idToImo.set(id, pImo);
 }
 
 //---------------------------------------------------------------------------------------
 void IdAssigner::add_control_id(ImoId id, Control* pControl)
 {
-    m_idToControl[id] = pControl;
+    m_idToControl.set(id, pControl);
 }
 
 
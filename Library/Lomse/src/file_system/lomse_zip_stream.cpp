@@ -368,7 +368,18 @@ long ZipInputStream::read(unsigned char* pDestBuffer, long nBytesToRead)
     memcpy(pDestBuffer, m_pNextChar, bytesRead);
     m_remainingBytes -= bytesRead;
     m_pNextChar += bytesRead;
-    pDestBuffer += bytesRead;
+
+    //decompress the rest directly into the destination, without passing through
+    //the internal buffer
+    if (bytesRead < nBytesToRead && !m_fIsLastBuffer)
+    {
+        long wanted = nBytesToRead - bytesRead;
+        int numBytes = unzReadCurrentFile(m_uzFile, pDestBuffer + bytesRead,
+                                          unsigned(wanted));
+        if (numBytes > 0)
+            bytesRead += numBytes;
+        m_fIsLastBuffer = (numBytes < wanted);
+    }
 
     if (m_remainingBytes == 0)
     {
@@ -382,9 +393,6 @@ long ZipInputStream::read(unsigned char* pDestBuffer, long nBytesToRead)
         }
     }
 
-    if (bytesRead < nBytesToRead && !m_curEntry.fEOF)
-        bytesRead += read(pDestBuffer, nBytesToRead - bytesRead);
-
     return bytesRead;
 }
 
@@ -44,6 +44,7 @@
 #include "lomse_box_slice.h"
 #include "lomse_logger.h"
 
+#include <atomic>
 #include <cstdlib>      //abs
 #include <iomanip>
 
@@ -55,7 +56,7 @@ namespace lomse
 //=======================================================================================
 // Graphic model implementation
 //=======================================================================================
-static long m_idCounter = 0L;
+static std::atomic<long> m_idCounter(0L);     //graphic models are built on several threads
 
 //---------------------------------------------------------------------------------------
 GraphicModel::GraphicModel()
@@ -161,7 +162,7 @@ void GraphicModel::store_in_map_imo_shape(ImoObj* pImo, GmoShape* pShape)
     if (idx > 0)
         m_imoToSecondaryShape[ make_pair(id, idx) ] = pShape;
     else
-        m_imoToMainShape[id] = pShape;
+        m_imoToMainShape.set(id, pShape);
 }
 
 //---------------------------------------------------------------------------------------
@@ -172,12 +173,12 @@ void GraphicModel::add_to_map_imo_to_box(GmoBox* pBox)
     {
         ImoId id = pImo->get_id();
         //DBG ------------------------------------------------------------
-        map<ImoId, GmoBox*>::const_iterator it = m_imoToBox.find(id);
-        if (it != m_imoToBox.end())
+        GmoBox* pExisting = m_imoToBox.get(id);
+        if (pExisting)
         {
             LOMSE_LOG_ERROR(
                 "Duplicated Imo id %d. Existing Gmo: %s. Adding Gmo: %s",
-                id, (it->second)->get_name().c_str(), pBox->get_name().c_str() );
+                id, pExisting->get_name().c_str(), pBox->get_name().c_str() );
             //TO_INVESTIGATE: This is not an error for DocPage and DocPageContent
             //boxes, as they can create more boxes when the content
             //is split in two or more physical pages. Maybe the
@@ -185,7 +186,7 @@ void GraphicModel::add_to_map_imo_to_box(GmoBox* pBox)
             //detected cases.
         }
         //END_DBG --------------------------------------------------------
-        m_imoToBox[id] = pBox;
+        m_imoToBox.set(id, pBox);
     }
 }
 
@@ -220,9 +221,9 @@ GmoShape* GraphicModel::get_shape_for_imo(ImoId id, ShapeId shapeId)
 //---------------------------------------------------------------------------------------
 GmoShape* GraphicModel::get_main_shape_for_imo(ImoId id)
 {
-    map<ImoId, GmoShape*>::const_iterator it = m_imoToMainShape.find(id);
-    if (it != m_imoToMainShape.end())
-        return it->second;
+    GmoShape* pShape = m_imoToMainShape.get(id);
+    if (pShape)
+        return pShape;
     else
     {
         LOMSE_LOG_DEBUG(Logger::k_score_player,
@@ -244,11 +245,7 @@ GmoObj* GraphicModel::get_box_for_control(GmoRef gref)
 //---------------------------------------------------------------------------------------
 GmoBox* GraphicModel::get_box_for_imo(ImoId id)
 {
-	map<ImoId, GmoBox*>::const_iterator it = m_imoToBox.find(id);
-	if (it != m_imoToBox.end())
-		return it->second;
-    else
-        return nullptr;
+    return m_imoToBox.get(id);
 }
 
 //---------------------------------------------------------------------------------------
@@ -33,6 +33,7 @@
 //#include "lomse_graphic_view.h"
 #include "lomse_logger.h"
 #include "lomse_visual_effect.h"
+#include "lomse_pixel_formats.h"
 
 
 namespace lomse
@@ -50,6 +51,7 @@ OverlaysGenerator::OverlaysGenerator(GraphicView* view, LibraryScope& librarySco
     , m_pSaveBytes(nullptr)
     , m_damagedRect(0.0, 0.0, 0.0, 0.0)
     , m_prevDamagedRect(0.0, 0.0, 0.0, 0.0)
+    , m_drawnRect(0, 0, 0, 0)
     , m_pHandlersOwner(nullptr)
 {
 }
@@ -85,7 +87,7 @@ void OverlaysGenerator::remove_visual_effect(VisualEffect* pEffect)
 void OverlaysGenerator::update_all_visual_effects(ScreenDrawer* pDrawer)
 {
     if (m_fBackgroundDirty)
-        m_pCanvasBuffer->copy_from(m_savedBuffer);
+        restore_rendering_buffer();
 
     m_damagedRect = URect(0.0, 0.0, 0.0, 0.0);
     int overlays = 0;
@@ -103,7 +105,10 @@ void OverlaysGenerator::update_all_visual_effects(ScreenDrawer* pDrawer)
     if (overlays == 0)
         m_damagedRect = m_prevDamagedRect;
     else
+    {
         expand_damaged_rectangle();
+        m_drawnRect = screen_rectangle(m_damagedRect, pDrawer);
+    }
 
     m_fBackgroundDirty = (overlays > 0);
 }
@@ -161,6 +166,89 @@ void OverlaysGenerator::save_rendering_buffer()
     m_fBackgroundDirty = false;
 }
 
+//---------------------------------------------------------------------------------------
+void OverlaysGenerator::restore_rendering_buffer()
+{
+    //Only the area covered by overlays is restored. Overlays are small (caret,
+    //tempo line, marks) and copying the whole buffer on each update is expensive
+    //for large views.
+
+    int bpp = bytes_per_pixel();
+    if (bpp == 0 || m_drawnRect.width <= 0 || m_drawnRect.height <= 0
+        || m_savedBuffer.width() != m_pCanvasBuffer->width()
+        || m_savedBuffer.height() != m_pCanvasBuffer->height())
+    {
+        m_pCanvasBuffer->copy_from(m_savedBuffer);
+        return;
+    }
+
+    size_t bytes = size_t(m_drawnRect.width * bpp);
+    for (int y = m_drawnRect.y; y < m_drawnRect.y + m_drawnRect.height; ++y)
+    {
+        memcpy(m_pCanvasBuffer->row_ptr(y) + m_drawnRect.x * bpp,
+               m_savedBuffer.row_ptr(y) + m_drawnRect.x * bpp, bytes);
+    }
+}
+
+//---------------------------------------------------------------------------------------
+VRect OverlaysGenerator::screen_rectangle(const URect& rect, ScreenDrawer* pDrawer)
+{
+    double left = rect.left();
+    double top = rect.top();
+    double right = rect.right();
+    double bottom = rect.bottom();
+    pDrawer->model_point_to_screen(&left, &top);
+    pDrawer->model_point_to_screen(&right, &bottom);
+
+    //trim rectangle to the rendering buffer
+    Pixels x1 = max(0, Pixels(floor(left)));
+    Pixels y1 = max(0, Pixels(floor(top)));
+    Pixels x2 = min(Pixels(ceil(right)), int(m_pCanvasBuffer->width()) );
+    Pixels y2 = min(Pixels(ceil(bottom)), int(m_pCanvasBuffer->height()) );
+
+    if (x2 <= x1 || y2 <= y1)
+        return VRect(0, 0, 0, 0);
+
+    return VRect(x1, y1, x2 - x1, y2 - y1);
+}
+
+//---------------------------------------------------------------------------------------
+int OverlaysGenerator::bytes_per_pixel()
+{
+    switch (m_libraryScope.get_pixel_format())
+    {
+        case k_pix_format_gray8:
+            return 1;
+        case k_pix_format_gray16:
+        case k_pix_format_rgb555:
+        case k_pix_format_rgb565:
+            return 2;
+        case k_pix_format_rgb24:
+        case k_pix_format_bgr24:
+            return 3;
+        case k_pix_format_rgbAAA:
+        case k_pix_format_bgrAAA:
+        case k_pix_format_rgbBBA:
+        case k_pix_format_bgrABB:
+        case k_pix_format_rgba32:
+        case k_pix_format_argb32:
+        case k_pix_format_abgr32:
+        case k_pix_format_bgra32:
+        case k_pix_format_bgra32_pre:
+            return 4;
+        case k_pix_format_rgb48:
+        case k_pix_format_bgr48:
+            return 6;
+        case k_pix_format_rgba64:
+        case k_pix_format_argb64:
+        case k_pix_format_abgr64:
+        case k_pix_format_bgra64:
+            return 8;
+        default:
+            return 0;   //unknown, the whole buffer will be restored
+    }
+}
+
 //---------------------------------------------------------------------------------------
 void OverlaysGenerator::expand_damaged_rectangle()
 {
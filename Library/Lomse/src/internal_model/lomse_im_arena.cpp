@@ -0,0 +1,192 @@
+//---------------------------------------------------------------------------------------
+// This file is part of the Lomse library.
+// Lomse is copyrighted work (c) 2010-2016. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without modification,
+// are permitted provided that the following conditions are met:
+//
+//    * Redistributions of source code must retain the above copyright notice, this
+//      list of conditions and the following disclaimer.
+//
+//    * Redistributions in binary form must reproduce the above copyright notice, this
+//      list of conditions and the following disclaimer in the documentation and/or
+//      other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+// OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+// SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+// INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+// TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+// BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+// ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+// DAMAGE.
+//
+// For any comment, suggestion or feature request, please contact the manager of
+// the project at cecilios@users.sourceforge.net
+//---------------------------------------------------------------------------------------
+
+#include "lomse_im_arena.h"
+
+#include <new>          //for ::operator new
+#include <cstring>      //for memset
+
+namespace lomse
+{
+
+//arena used by ImoObj::operator new in current thread, or nullptr for the heap
+static thread_local ImoArena* t_pCurrentArena = nullptr;
+
+//---------------------------------------------------------------------------------------
+//header preceding each block. Its size preserves the alignment of the objects
+struct alignas(std::max_align_t) ImoArenaHeader
+{
+    ImoArena* pArena;           //nullptr when the block is taken from the heap
+    size_t iSize;               //size index in the arena
+};
+
+
+//=======================================================================================
+// ImoArena implementation
+//=======================================================================================
+ImoArena::ImoArena()
+    : m_pFree(nullptr)
+    , m_pEnd(nullptr)
+    , m_numBlocks(0)
+    , m_numAllocations(0)
+    , m_fReleased(false)
+    , m_fConcurrent(false)
+{
+    memset(m_freeBlocks, 0, sizeof(m_freeBlocks));
+}
+
+//---------------------------------------------------------------------------------------
+ImoArena::~ImoArena()
+{
+    std::vector<char*>::iterator it;
+    for (it = m_chunks.begin(); it != m_chunks.end(); ++it)
+        ::operator delete(*it);
+}
+
+//---------------------------------------------------------------------------------------
+void ImoArena::release()
+{
+    //The owner will not allocate more blocks. Objects still alive (i.e. detached
+    //from the document and owned by others) keep the arena until they are deleted.
+    bool fDelete;
+    {
+        std::unique_lock<std::mutex> lock(m_mutex, std::defer_lock);
+        if (m_fConcurrent)
+            lock.lock();
+        m_fReleased = true;
+        fDelete = (m_numBlocks == 0);
+    }
+    if (fDelete)
+        delete this;
+}
+
+//---------------------------------------------------------------------------------------
+void* ImoArena::allocate(size_t size)
+{
+    size_t total = size + sizeof(ImoArenaHeader);
+    ImoArena* pArena = t_pCurrentArena;
+    ImoArenaHeader* pHeader;
+    if (pArena && total <= k_max_block)
+    {
+        size_t iSize = (total - 1) / k_granularity;
+        pHeader = static_cast<ImoArenaHeader*>( pArena->allocate_block(iSize) );
+        pHeader->iSize = iSize;
+    }
+    else
+    {
+        pArena = nullptr;
+        pHeader = static_cast<ImoArenaHeader*>( ::operator new(total) );
+    }
+    pHeader->pArena = pArena;
+    return pHeader + 1;
+}
+
+//---------------------------------------------------------------------------------------
+void ImoArena::deallocate(void* p)
+{
+    if (!p)
+        return;
+
+    ImoArenaHeader* pHeader = static_cast<ImoArenaHeader*>(p) - 1;
+    ImoArena* pArena = pHeader->pArena;
+    if (!pArena)
+        ::operator delete(pHeader);
+    else if (pArena->free_block(pHeader, pHeader->iSize))
+        delete pArena;
+}
+
+//---------------------------------------------------------------------------------------
+void* ImoArena::allocate_block(size_t iSize)
+{
+    std::unique_lock<std::mutex> lock(m_mutex, std::defer_lock);
+    if (m_fConcurrent)
+        lock.lock();
+
+    ++m_numBlocks;
+    ++m_numAllocations;
+
+    void* pBlock = m_freeBlocks[iSize];
+    if (pBlock)
+    {
+        m_freeBlocks[iSize] = *static_cast<void**>(pBlock);
+        return pBlock;
+    }
+
+    size_t bytes = (iSize + 1) * k_granularity;
+    if (m_pFree + bytes > m_pEnd)
+    {
+        //the remaining of current chunk is lost. At most k_max_block bytes
+        m_pFree = new_chunk();
+        m_pEnd = m_pFree + k_chunk_size;
+    }
+    pBlock = m_pFree;
+    m_pFree += bytes;
+    return pBlock;
+}
+
+//---------------------------------------------------------------------------------------
+bool ImoArena::free_block(void* pBlock, size_t iSize)
+{
+    //returns true when the arena is no longer needed and must be deleted
+
+    std::unique_lock<std::mutex> lock(m_mutex, std::defer_lock);
+    if (m_fConcurrent)
+        lock.lock();
+
+    *static_cast<void**>(pBlock) = m_freeBlocks[iSize];
+    m_freeBlocks[iSize] = pBlock;
+    return --m_numBlocks == 0 && m_fReleased;
+}
+
+//---------------------------------------------------------------------------------------
+char* ImoArena::new_chunk()
+{
+    char* pChunk = static_cast<char*>( ::operator new(k_chunk_size) );
+    m_chunks.push_back(pChunk);
+    return pChunk;
+}
+
+
+//=======================================================================================
+// ImoArena::Scope implementation
+//=======================================================================================
+ImoArena::Scope::Scope(ImoArena* pArena)
+    : m_pPrevious(t_pCurrentArena)
+{
+    t_pCurrentArena = pArena;
+}
+
+//---------------------------------------------------------------------------------------
+ImoArena::Scope::~Scope()
+{
+    t_pCurrentArena = m_pPrevious;
+}
+
+
+}  //namespace lomse
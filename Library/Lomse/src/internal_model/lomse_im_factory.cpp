@@ -47,6 +47,7 @@ ImoObj* ImFactory::inject(Document* pDoc, const std::string& ldpSource)
 //---------------------------------------------------------------------------------------
 ImoObj* ImFactory::inject(int type, Document* pDoc, ImoId id)
 {
+    ImoArena::Scope arena( pDoc->get_imo_arena() );
     ImoObj* pObj = nullptr;
 
     if (!(type > k_imo_dto && type < k_imo_dto_last))
@@ -158,6 +159,7 @@ ImoObj* ImFactory::inject(int type, Document* pDoc, ImoId id)
 //---------------------------------------------------------------------------------------
 ImoBeamData* ImFactory::inject_beam_data(Document* pDoc, ImoBeamDto* pDto)
 {
+    ImoArena::Scope arena( pDoc->get_imo_arena() );
     ImoBeamData* pObj = LOMSE_NEW ImoBeamData(pDto);
     pDoc->assign_id(pObj);
     pObj->set_owner_document(pDoc);
@@ -167,6 +169,7 @@ ImoBeamData* ImFactory::inject_beam_data(Document* pDoc, ImoBeamDto* pDto)
 //---------------------------------------------------------------------------------------
 ImoTieData* ImFactory::inject_tie_data(Document* pDoc, ImoTieDto* pDto)
 {
+    ImoArena::Scope arena( pDoc->get_imo_arena() );
     ImoTieData* pObj = LOMSE_NEW ImoTieData(pDto);
     pDoc->assign_id(pObj);
     pObj->set_owner_document(pDoc);
@@ -176,6 +179,7 @@ ImoTieData* ImFactory::inject_tie_data(Document* pDoc, ImoTieDto* pDto)
 //---------------------------------------------------------------------------------------
 ImoSlurData* ImFactory::inject_slur_data(Document* pDoc, ImoSlurDto* pDto)
 {
+    ImoArena::Scope arena( pDoc->get_imo_arena() );
     ImoSlurData* pObj = LOMSE_NEW ImoSlurData(pDto);
     pDoc->assign_id(pObj);
     pObj->set_owner_document(pDoc);
@@ -185,6 +189,7 @@ ImoSlurData* ImFactory::inject_slur_data(Document* pDoc, ImoSlurDto* pDto)
 //---------------------------------------------------------------------------------------
 ImoTuplet* ImFactory::inject_tuplet(Document* pDoc, ImoTupletDto* pDto)
 {
+    ImoArena::Scope arena( pDoc->get_imo_arena() );
     ImoTuplet* pObj = LOMSE_NEW ImoTuplet(pDto);
     pObj->set_id( pDto->get_id() );
     pDoc->assign_id(pObj);
@@ -195,6 +200,7 @@ ImoTuplet* ImFactory::inject_tuplet(Document* pDoc, ImoTupletDto* pDto)
 //---------------------------------------------------------------------------------------
 ImoTextBox* ImFactory::inject_text_box(Document* pDoc, ImoTextBlockInfo& dto, ImoId id)
 {
+    ImoArena::Scope arena( pDoc->get_imo_arena() );
     ImoTextBox* pObj = LOMSE_NEW ImoTextBox(dto);
     pObj->set_id(id);
     pDoc->assign_id(pObj);
@@ -207,6 +213,7 @@ ImoNote* ImFactory::inject_note(Document* pDoc, int step, int octave,
                                 int noteType, EAccidentals accidentals,
                                 int dots, int staff, int voice, int stem)
 {
+    ImoArena::Scope arena( pDoc->get_imo_arena() );
     ImoNote* pObj = LOMSE_NEW ImoNote(step, octave, noteType, accidentals, dots,
                                 staff, voice, stem);
     pDoc->assign_id(pObj);
@@ -217,6 +224,7 @@ ImoNote* ImFactory::inject_note(Document* pDoc, int step, int octave,
 //---------------------------------------------------------------------------------------
 ImoMultiColumn* ImFactory::inject_multicolumn(Document* pDoc)
 {
+    ImoArena::Scope arena( pDoc->get_imo_arena() );
     ImoMultiColumn* pObj = LOMSE_NEW ImoMultiColumn(pDoc);
     pDoc->assign_id(pObj);
     pObj->set_owner_document(pDoc);
@@ -227,6 +235,7 @@ ImoMultiColumn* ImFactory::inject_multicolumn(Document* pDoc)
 ImoImage* ImFactory::inject_image(Document* pDoc, unsigned char* imgbuf, VSize bmpSize,
                                   EPixelFormat format, USize imgSize)
 {
+    ImoArena::Scope arena( pDoc->get_imo_arena() );
     ImoImage* pObj = LOMSE_NEW ImoImage(imgbuf, bmpSize, format, imgSize);
     pDoc->assign_id(pObj);
     pObj->set_owner_document(pDoc);
@@ -236,6 +245,7 @@ ImoImage* ImFactory::inject_image(Document* pDoc, unsigned char* imgbuf, VSize b
 //---------------------------------------------------------------------------------------
 ImoControl* ImFactory::inject_control(Document* pDoc, Control* ctrol)
 {
+    ImoArena::Scope arena( pDoc->get_imo_arena() );
     ImoControl* pObj = LOMSE_NEW ImoControl(ctrol);
     pDoc->assign_id(pObj);
     pObj->set_owner_document(pDoc);
@@ -63,9 +63,6 @@ LUnits pt_to_LUnits(float pt)
 }
 
 //---------------------------------------------------------------------------------------
-// static variables to convert from ImoObj type to name
-static map<int, string> m_TypeToName;
-static bool m_fNamesRegistered;
 //static string m_unknown = "unknown";
 
 //---------------------------------------------------------------------------------------
@@ -430,175 +427,182 @@ void ImoObj::delete_attributes()
     }
 }
 
+//---------------------------------------------------------------------------------------
+//converts from ImoObj type to name
+static map<int, string> register_type_names()
+{
+    map<int, string> typeToName;
+
+    // ImoStaffObj (A)
+    typeToName[k_imo_barline] = "barline";
+    typeToName[k_imo_clef] = "clef";
+    typeToName[k_imo_direction] = "direction";
+    typeToName[k_imo_figured_bass] = "figured-bass";
+    typeToName[k_imo_go_back_fwd] = "go-back-fwd";
+    typeToName[k_imo_key_signature] = "key-signature";
+    typeToName[k_imo_note] = "note";
+    typeToName[k_imo_rest] = "rest";
+    typeToName[k_imo_system_break] = "system-break";
+    typeToName[k_imo_time_signature] = "time-signature";
+
+    // ImoBlocksContainer (A)
+    typeToName[k_imo_content] = "content";
+    typeToName[k_imo_dynamic] = "dynamic";
+    typeToName[k_imo_document] = "lenmusdoc";
+    typeToName[k_imo_list] = "list";
+    typeToName[k_imo_listitem] = "listitem";
+    typeToName[k_imo_multicolumn] = "multicolumn";
+    typeToName[k_imo_table] = "table";
+    typeToName[k_imo_table_cell] = "table-cell";
+    typeToName[k_imo_table_row] = "table-row";
+    typeToName[k_imo_score] = "score";
+
+    // ImoInlinesContainer (A)
+    typeToName[k_imo_anonymous_block] = "anonymous-block";
+    typeToName[k_imo_heading] = "heading";
+    typeToName[k_imo_para] = "paragraph";
+
+    // ImoInlineLevelObj
+    typeToName[k_imo_button] = "buttom";
+    typeToName[k_imo_control] = "control";
+    typeToName[k_imo_image] = "image";
+    typeToName[k_imo_score_player] = "score-player";
+    typeToName[k_imo_text_item] = "text";
+
+    // ImoBoxInline (A)
+    typeToName[k_imo_link] = "link";
+    typeToName[k_imo_inline_wrapper] = "wrapper";
+
+    // ImoDto, ImoSimpleObj (A)
+    typeToName[k_imo_beam_dto] = "beam";
+    typeToName[k_imo_bezier_info] = "bezier";
+    typeToName[k_imo_border_dto] = "border";
+    typeToName[k_imo_color_dto] = "color";
+    typeToName[k_imo_cursor_info] = "cursor";
+    typeToName[k_imo_figured_bass_info] = "figured-bass";
+    typeToName[k_imo_font_style_dto] = "font-style";
+    typeToName[k_imo_instr_group] = "instr-group";
+    typeToName[k_imo_line_style] = "line-style";
+    typeToName[k_imo_lyrics_text_info] = "lyric-text";
+    typeToName[k_imo_midi_info] = "midi-info";
+    typeToName[k_imo_option] = "opt";
+    typeToName[k_imo_page_info] = "page-info";
+    typeToName[k_imo_param_info] = "param";
+    typeToName[k_imo_point_dto] = "point";
+    typeToName[k_imo_size_dto] = "size";
+    typeToName[k_imo_slur_dto] = "slur-dto";
+    typeToName[k_imo_sound_change] = "sound-change";
+    typeToName[k_imo_sound_info] = "sound-info";
+    typeToName[k_imo_staff_info] = "staff-info";
+    typeToName[k_imo_style] = "style";
+    typeToName[k_imo_system_info] = "system-info";
+    typeToName[k_imo_textblock_info] = "textblock";
+    typeToName[k_imo_text_info] = "text-info";
+    typeToName[k_imo_text_style] = "text-style";
+    typeToName[k_imo_tie_dto] = "tie-dto";
+    typeToName[k_imo_time_modification_dto] = "time-modificator-dto";
+    typeToName[k_imo_tuplet_dto] = "tuplet-dto";
+    typeToName[k_imo_volta_bracket_dto] = "volta_bracket_dto";
+
+    // ImoRelDataObj (A)
+    typeToName[k_imo_beam_data] = "beam-data";
+    typeToName[k_imo_slur_data] = "slur-data";
+    typeToName[k_imo_tie_data] = "tie-data";
+//
+    //ImoCollection(A)
+    typeToName[k_imo_instruments] = "instruments";
+    typeToName[k_imo_instrument_groups] = "instr-groups";
+    typeToName[k_imo_music_data] = "musicData";
+    typeToName[k_imo_options] = "options";
+    typeToName[k_imo_styles] = "styles";
+    typeToName[k_imo_sounds] = "sounds";
+    typeToName[k_imo_table_head] = "table-head";
+    typeToName[k_imo_table_body] = "table-body";
+
+    // Special collections
+    typeToName[k_imo_attachments] = "attachments";
+    typeToName[k_imo_relations] = "relations";
+
+    // ImoContainerObj (A)
+    typeToName[k_imo_instrument] = "instrument";
+
+    // ImoAuxObj (A)
+    typeToName[k_imo_articulation_line] = "articulation-line";
+    typeToName[k_imo_articulation_symbol] = "articulation-symbol";
+    typeToName[k_imo_dynamics_mark] = "dynamics-mark";
+    typeToName[k_imo_fermata] = "fermata";
+    typeToName[k_imo_line] = "line";
+    typeToName[k_imo_metronome_mark] = "metronome-mark";
+    typeToName[k_imo_ornament] = "ornament";
+    typeToName[k_imo_score_text] = "score-text";
+    typeToName[k_imo_score_line] = "score-line";
+    typeToName[k_imo_score_title] = "title";
+    typeToName[k_imo_symbol_repetition_mark] = "symbol-repetition-mark";
+    typeToName[k_imo_technical] = "technical";
+    typeToName[k_imo_text_box] = "text-box";
+    typeToName[k_imo_text_repetition_mark] = "text-repetition-mark";
+
+    // ImoAuxRelObj (A)
+    typeToName[k_imo_lyric] = "lyric";
+
+    // ImoRelObj (A)
+    typeToName[k_imo_beam] = "beam";
+    typeToName[k_imo_chord] = "chord";
+    typeToName[k_imo_slur] = "slur";
+    typeToName[k_imo_tie] = "tie";
+    typeToName[k_imo_tuplet] = "tuplet";
+    typeToName[k_imo_volta_bracket] = "volta-bracket";
+
+    //abstract and non-valid objects
+    typeToName[k_imo_obj] = "non-valid";
+    typeToName[k_imo_dto] = "non-valid";
+    typeToName[k_imo_dto_last] = "non-valid";
+    typeToName[k_imo_simpleobj] = "non-valid";
+    typeToName[k_imo_simpleobj_last] = "non-valid";
+    typeToName[k_imo_reldataobj] = "non-valid";
+    typeToName[k_imo_reldataobj_last] = "non-valid";
+    typeToName[k_imo_collection] = "non-valid";
+    typeToName[k_imo_collection_last] = "non-valid";
+    typeToName[k_imo_containerobj] = "non-valid";
+    typeToName[k_imo_containerobj_last] = "non-valid";
+    typeToName[k_imo_contentobj] = "non-valid";
+    typeToName[k_imo_scoreobj] = "non-valid";
+    typeToName[k_imo_staffobj] = "non-valid";
+    typeToName[k_imo_staffobj_last] = "non-valid";
+    typeToName[k_imo_auxobj] = "non-valid";
+    typeToName[k_imo_auxrelobj] = "non-valid";
+    typeToName[k_imo_auxobj_last] = "non-valid";
+    typeToName[k_imo_relobj] = "non-valid";
+    typeToName[k_imo_relobj_last] = "non-valid";
+    typeToName[k_imo_scoreobj_last] = "non-valid";
+    typeToName[k_imo_block_level_obj] = "non-valid";
+    typeToName[k_imo_blocks_container] = "non-valid";
+    typeToName[k_imo_blocks_container_last] = "non-valid";
+    typeToName[k_imo_inlines_container] = "non-valid";
+    typeToName[k_imo_inlines_container_last] = "non-valid";
+    typeToName[k_imo_block_level_obj_last] = "non-valid";
+    typeToName[k_imo_inline_level_obj] = "non-valid";
+    typeToName[k_imo_control_end] = "non-valid";
+    typeToName[k_imo_box_inline] = "non-valid";
+    typeToName[k_imo_box_inline_last] = "non-valid";
+    typeToName[k_imo_inline_level_obj_last] = "non-valid";
+    typeToName[k_imo_contentobj_last] = "non-valid";
+    typeToName[k_imo_articulation] = "non-valid";
+    typeToName[k_imo_articulation_last] = "non-valid";
+    typeToName[k_imo_last] = "non-valid";
+
+    return typeToName;
+}
+
 //---------------------------------------------------------------------------------------
 const string& ImoObj::get_name(int type)
 {
-    //Register all IM objects
-    if (!m_fNamesRegistered)
-    {
-        // ImoStaffObj (A)
-        m_TypeToName[k_imo_barline] = "barline";
-        m_TypeToName[k_imo_clef] = "clef";
-        m_TypeToName[k_imo_direction] = "direction";
-        m_TypeToName[k_imo_figured_bass] = "figured-bass";
-        m_TypeToName[k_imo_go_back_fwd] = "go-back-fwd";
-        m_TypeToName[k_imo_key_signature] = "key-signature";
-        m_TypeToName[k_imo_note] = "note";
-        m_TypeToName[k_imo_rest] = "rest";
-        m_TypeToName[k_imo_system_break] = "system-break";
-        m_TypeToName[k_imo_time_signature] = "time-signature";
-
-        // ImoBlocksContainer (A)
-        m_TypeToName[k_imo_content] = "content";
-        m_TypeToName[k_imo_dynamic] = "dynamic";
-        m_TypeToName[k_imo_document] = "lenmusdoc";
-        m_TypeToName[k_imo_list] = "list";
-        m_TypeToName[k_imo_listitem] = "listitem";
-        m_TypeToName[k_imo_multicolumn] = "multicolumn";
-        m_TypeToName[k_imo_table] = "table";
-        m_TypeToName[k_imo_table_cell] = "table-cell";
-        m_TypeToName[k_imo_table_row] = "table-row";
-        m_TypeToName[k_imo_score] = "score";
-
-        // ImoInlinesContainer (A)
-        m_TypeToName[k_imo_anonymous_block] = "anonymous-block";
-        m_TypeToName[k_imo_heading] = "heading";
-        m_TypeToName[k_imo_para] = "paragraph";
-
-        // ImoInlineLevelObj
-        m_TypeToName[k_imo_button] = "buttom";
-        m_TypeToName[k_imo_control] = "control";
-        m_TypeToName[k_imo_image] = "image";
-        m_TypeToName[k_imo_score_player] = "score-player";
-        m_TypeToName[k_imo_text_item] = "text";
-
-        // ImoBoxInline (A)
-        m_TypeToName[k_imo_link] = "link";
-        m_TypeToName[k_imo_inline_wrapper] = "wrapper";
-
-        // ImoDto, ImoSimpleObj (A)
-        m_TypeToName[k_imo_beam_dto] = "beam";
-        m_TypeToName[k_imo_bezier_info] = "bezier";
-        m_TypeToName[k_imo_border_dto] = "border";
-        m_TypeToName[k_imo_color_dto] = "color";
-        m_TypeToName[k_imo_cursor_info] = "cursor";
-        m_TypeToName[k_imo_figured_bass_info] = "figured-bass";
-        m_TypeToName[k_imo_font_style_dto] = "font-style";
-        m_TypeToName[k_imo_instr_group] = "instr-group";
-        m_TypeToName[k_imo_line_style] = "line-style";
-        m_TypeToName[k_imo_lyrics_text_info] = "lyric-text";
-        m_TypeToName[k_imo_midi_info] = "midi-info";
-        m_TypeToName[k_imo_option] = "opt";
-        m_TypeToName[k_imo_page_info] = "page-info";
-        m_TypeToName[k_imo_param_info] = "param";
-        m_TypeToName[k_imo_point_dto] = "point";
-        m_TypeToName[k_imo_size_dto] = "size";
-        m_TypeToName[k_imo_slur_dto] = "slur-dto";
-        m_TypeToName[k_imo_sound_change] = "sound-change";
-        m_TypeToName[k_imo_sound_info] = "sound-info";
-        m_TypeToName[k_imo_staff_info] = "staff-info";
-        m_TypeToName[k_imo_style] = "style";
-        m_TypeToName[k_imo_system_info] = "system-info";
-        m_TypeToName[k_imo_textblock_info] = "textblock";
-        m_TypeToName[k_imo_text_info] = "text-info";
-        m_TypeToName[k_imo_text_style] = "text-style";
-        m_TypeToName[k_imo_tie_dto] = "tie-dto";
-        m_TypeToName[k_imo_time_modification_dto] = "time-modificator-dto";
-        m_TypeToName[k_imo_tuplet_dto] = "tuplet-dto";
-        m_TypeToName[k_imo_volta_bracket_dto] = "volta_bracket_dto";
-
-        // ImoRelDataObj (A)
-        m_TypeToName[k_imo_beam_data] = "beam-data";
-        m_TypeToName[k_imo_slur_data] = "slur-data";
-        m_TypeToName[k_imo_tie_data] = "tie-data";
-//
-        //ImoCollection(A)
-        m_TypeToName[k_imo_instruments] = "instruments";
-        m_TypeToName[k_imo_instrument_groups] = "instr-groups";
-        m_TypeToName[k_imo_music_data] = "musicData";
-        m_TypeToName[k_imo_options] = "options";
-        m_TypeToName[k_imo_styles] = "styles";
-        m_TypeToName[k_imo_sounds] = "sounds";
-        m_TypeToName[k_imo_table_head] = "table-head";
-        m_TypeToName[k_imo_table_body] = "table-body";
-
-        // Special collections
-        m_TypeToName[k_imo_attachments] = "attachments";
-        m_TypeToName[k_imo_relations] = "relations";
-
-        // ImoContainerObj (A)
-        m_TypeToName[k_imo_instrument] = "instrument";
-
-        // ImoAuxObj (A)
-        m_TypeToName[k_imo_articulation_line] = "articulation-line";
-        m_TypeToName[k_imo_articulation_symbol] = "articulation-symbol";
-        m_TypeToName[k_imo_dynamics_mark] = "dynamics-mark";
-        m_TypeToName[k_imo_fermata] = "fermata";
-        m_TypeToName[k_imo_line] = "line";
-        m_TypeToName[k_imo_metronome_mark] = "metronome-mark";
-        m_TypeToName[k_imo_ornament] = "ornament";
-        m_TypeToName[k_imo_score_text] = "score-text";
-        m_TypeToName[k_imo_score_line] = "score-line";
-        m_TypeToName[k_imo_score_title] = "title";
-        m_TypeToName[k_imo_symbol_repetition_mark] = "symbol-repetition-mark";
-        m_TypeToName[k_imo_technical] = "technical";
-        m_TypeToName[k_imo_text_box] = "text-box";
-        m_TypeToName[k_imo_text_repetition_mark] = "text-repetition-mark";
-
-        // ImoAuxRelObj (A)
-        m_TypeToName[k_imo_lyric] = "lyric";
-
-        // ImoRelObj (A)
-        m_TypeToName[k_imo_beam] = "beam";
-        m_TypeToName[k_imo_chord] = "chord";
-        m_TypeToName[k_imo_slur] = "slur";
-        m_TypeToName[k_imo_tie] = "tie";
-        m_TypeToName[k_imo_tuplet] = "tuplet";
-        m_TypeToName[k_imo_volta_bracket] = "volta-bracket";
-
-        //abstract and non-valid objects
-        m_TypeToName[k_imo_obj] = "non-valid";
-        m_TypeToName[k_imo_dto] = "non-valid";
-        m_TypeToName[k_imo_dto_last] = "non-valid";
-        m_TypeToName[k_imo_simpleobj] = "non-valid";
-        m_TypeToName[k_imo_simpleobj_last] = "non-valid";
-        m_TypeToName[k_imo_reldataobj] = "non-valid";
-        m_TypeToName[k_imo_reldataobj_last] = "non-valid";
-        m_TypeToName[k_imo_collection] = "non-valid";
-        m_TypeToName[k_imo_collection_last] = "non-valid";
-        m_TypeToName[k_imo_containerobj] = "non-valid";
-        m_TypeToName[k_imo_containerobj_last] = "non-valid";
-        m_TypeToName[k_imo_contentobj] = "non-valid";
-        m_TypeToName[k_imo_scoreobj] = "non-valid";
-        m_TypeToName[k_imo_staffobj] = "non-valid";
-        m_TypeToName[k_imo_staffobj_last] = "non-valid";
-        m_TypeToName[k_imo_auxobj] = "non-valid";
-        m_TypeToName[k_imo_auxrelobj] = "non-valid";
-        m_TypeToName[k_imo_auxobj_last] = "non-valid";
-        m_TypeToName[k_imo_relobj] = "non-valid";
-        m_TypeToName[k_imo_relobj_last] = "non-valid";
-        m_TypeToName[k_imo_scoreobj_last] = "non-valid";
-        m_TypeToName[k_imo_block_level_obj] = "non-valid";
-        m_TypeToName[k_imo_blocks_container] = "non-valid";
-        m_TypeToName[k_imo_blocks_container_last] = "non-valid";
-        m_TypeToName[k_imo_inlines_container] = "non-valid";
-        m_TypeToName[k_imo_inlines_container_last] = "non-valid";
-        m_TypeToName[k_imo_block_level_obj_last] = "non-valid";
-        m_TypeToName[k_imo_inline_level_obj] = "non-valid";
-        m_TypeToName[k_imo_control_end] = "non-valid";
-        m_TypeToName[k_imo_box_inline] = "non-valid";
-        m_TypeToName[k_imo_box_inline_last] = "non-valid";
-        m_TypeToName[k_imo_inline_level_obj_last] = "non-valid";
-        m_TypeToName[k_imo_contentobj_last] = "non-valid";
-        m_TypeToName[k_imo_articulation] = "non-valid";
-        m_TypeToName[k_imo_articulation_last] = "non-valid";
-        m_TypeToName[k_imo_last] = "non-valid";
-
-        m_fNamesRegistered = true;
-    }
+    //Register all IM objects. Initialization of a local static is thread safe,
+    //and the map is not modified after it
+    static const map<int, string> typeToName = register_type_names();
 
-	map<int, std::string>::const_iterator it = m_TypeToName.find( type );
-	if (it != m_TypeToName.end())
+	map<int, std::string>::const_iterator it = typeToName.find( type );
+	if (it != typeToName.end())
 		return it->second;
     else
     {
@@ -1842,22 +1846,18 @@ void ImoRelations::add_relation(ImoRelObj* pRO)
 //---------------------------------------------------------------------------------------
 int ImoRelations::get_priority(int type)
 {
-    //not listed objects are low priority (order not important, added at end)
-    static bool fMapInitialized = false;
-    static map<int, int> priority;
-
-    if (!fMapInitialized)
-    {
-        priority[k_imo_tie] = 0;
-        priority[k_imo_beam] = 1;
-        priority[k_imo_chord] = 2;
-        priority[k_imo_tuplet] = 3;
-        priority[k_imo_volta_bracket] = 4;
-        priority[k_imo_slur] = 5;
-        priority[k_imo_fermata] = 6;
-        priority[k_imo_text_repetition_mark] = 7;
-
-        fMapInitialized = true;
+    //not listed objects are low priority (order not important, added at end).
+    //Relations are added by part analysers running in parallel threads, so the
+    //map is built once, when the static is initialized
+    static const map<int, int> priority = {
+        { k_imo_tie, 0 },
+        { k_imo_beam, 1 },
+        { k_imo_chord, 2 },
+        { k_imo_tuplet, 3 },
+        { k_imo_volta_bracket, 4 },
+        { k_imo_slur, 5 },
+        { k_imo_fermata, 6 },
+        { k_imo_text_repetition_mark, 7 },
     };
 
 	map<int, int>::const_iterator it = priority.find( type );
@@ -3751,6 +3751,13 @@ void ImoScore::end_of_changes()
     builder.structurize(this);
 }
 
+//---------------------------------------------------------------------------------------
+void ImoScore::end_of_changes(int iInstr, int firstMeasure, int lastMeasure)
+{
+    ModelBuilder builder;
+    builder.update_structure(this, iInstr, firstMeasure, lastMeasure);
+}
+
 
 
 //=======================================================================================
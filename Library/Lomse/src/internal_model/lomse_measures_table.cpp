@@ -48,10 +48,13 @@ ImMeasuresTableEntry::ImMeasuresTableEntry(ColStaffObjsEntry* pEntry)
     , m_firstId(-1)
     , m_bottomBeat(LOMSE_NO_DURATION)
     , m_impliedBeat(LOMSE_NO_DURATION)
-    , m_pCsoEntry(pEntry)
+    , m_pStaffObj(nullptr)
 {
     if (pEntry != nullptr)
+    {
         m_timepos = pEntry->time();
+        m_pStaffObj = pEntry->imo_object();
+    }
 }
 
 //---------------------------------------------------------------------------------------
@@ -61,7 +64,7 @@ ImMeasuresTableEntry::ImMeasuresTableEntry()
     , m_firstId(-1)
     , m_bottomBeat(LOMSE_NO_DURATION)
     , m_impliedBeat(LOMSE_NO_DURATION)
-    , m_pCsoEntry(nullptr)
+    , m_pStaffObj(nullptr)
 {
 }
 
@@ -72,8 +75,8 @@ string ImMeasuresTableEntry::dump()
     s << m_index << "\t" << m_timepos << "\t" << m_bottomBeat << "\t"
       << m_impliedBeat << "\t";
 
-    if (m_pCsoEntry != nullptr)
-        s << m_pCsoEntry->to_string_with_ids();
+    if (m_pStaffObj != nullptr)
+        s << m_pStaffObj->to_string_with_ids();
     s << endl;
     return s.str();
 }
@@ -106,6 +109,15 @@ ImMeasuresTableEntry* ImMeasuresTable::add_entry(ColStaffObjsEntry* pCsoEntry)
     return pEntry;
 }
 
+//---------------------------------------------------------------------------------------
+void ImMeasuresTable::delete_entries_from(int iMeasure)
+{
+    for (int i = iMeasure; i < num_entries(); ++i)
+        delete m_theTable[i];
+    if (iMeasure < num_entries())
+        m_theTable.resize(iMeasure);
+}
+
 //---------------------------------------------------------------------------------------
 ImMeasuresTableEntry* ImMeasuresTable::get_measure(int iMeasure)
 {
@@ -176,5 +188,31 @@ ImMeasuresTableEntry* ImMeasuresTable::get_measure_at(TimeUnits timepos)
     return nullptr;
 }
 
+//---------------------------------------------------------------------------------------
+ImMeasuresTableEntry* ImMeasuresTable::find_measure_starting_with(ImoStaffObj* pSO)
+{
+    //Binary search for the first measure starting at the timepos of pSO, and then
+    //linear search for the one starting with pSO. Returns nullptr if not found.
+
+    TimeUnits timepos = pSO->get_time();
+    int first = 0;
+    int last = num_entries();
+    while (first < last)
+    {
+        int guess = (first + last) / 2;
+        if (m_theTable[guess]->get_timepos() < timepos)
+            first = guess + 1;
+        else
+            last = guess;
+    }
+
+    for (int i = first; i < num_entries() && m_theTable[i]->get_timepos() == timepos; ++i)
+    {
+        if (m_theTable[i]->get_staffobj() == pSO)
+            return m_theTable[i];
+    }
+    return nullptr;
+}
+
 
 }  //namespace lomse
@@ -113,6 +113,92 @@ void ModelBuilder::structurize(ImoObj* pImo)
     }
 }
 
+//---------------------------------------------------------------------------------------
+void ModelBuilder::update_structure(ImoScore* pScore, int iInstr, int firstMeasure,
+                                    int lastMeasure)
+{
+    //Same as structurize() for changes restricted to the staffobjs of instrument iInstr
+    //in measures [firstMeasure, lastMeasure], numbered as before the changes. When
+    //possible, only the affected part of the structures is rebuilt.
+
+    ColStaffObjsBuilder builder;
+    if (!builder.update(pScore, iInstr, firstMeasure, lastMeasure))
+    {
+        structurize(pScore);
+        return;
+    }
+
+    //midi data depends only on the instruments. No changes
+
+    ColStaffObjsEntry* pFirst = builder.first_updated_entry();
+    MeasuresTableBuilder measures;
+    measures.update(pScore, iInstr, pFirst);
+
+    PitchAssigner tuner;
+    tuner.update_pitch(pScore, iInstr, pFirst, builder.last_updated_entry(),
+                       builder.signatures_updated());
+}
+
+
+
+//=======================================================================================
+// StructureChecker implementation
+//=======================================================================================
+bool StructureChecker::check(ImoScore* pScore, ostream& reporter)
+{
+    string current = dump_structures(pScore);
+    ModelBuilder builder;
+    builder.structurize(pScore);
+    string expected = dump_structures(pScore);
+    if (current == expected)
+        return true;
+
+    //report first difference
+    stringstream sCurrent(current);
+    stringstream sExpected(expected);
+    string lineCurrent;
+    string lineExpected;
+    int line = 1;
+    while (getline(sCurrent, lineCurrent) && getline(sExpected, lineExpected)
+           && lineCurrent == lineExpected)
+    {
+        ++line;
+    }
+    reporter << "Score structures differ at line " << line << ": [" << lineCurrent
+             << "], expected [" << lineExpected << "]" << endl;
+    return false;
+}
+
+//---------------------------------------------------------------------------------------
+string StructureChecker::dump_structures(ImoScore* pScore)
+{
+    stringstream s;
+    ColStaffObjs* pColStaffObjs = pScore->get_staffobjs_table();
+    s << pColStaffObjs->dump() << pColStaffObjs->dump_builder_data();
+
+    int numInstrs = pScore->get_num_instruments();
+    for (int iInstr=0; iInstr < numInstrs; ++iInstr)
+    {
+        ImMeasuresTable* pTable = pScore->get_instrument(iInstr)->get_measures_table();
+        s << "Measures table for instrument " << iInstr << endl;
+        if (pTable)
+            s << pTable->dump();
+    }
+
+    ColStaffObjsIterator it;
+    for (it = pColStaffObjs->begin(); it != pColStaffObjs->end(); ++it)
+    {
+        ImoStaffObj* pSO = (*it)->imo_object();
+        if (pSO->is_note())
+        {
+            ImoNote* pNote = static_cast<ImoNote*>(pSO);
+            s << pNote->get_id() << "\t" << pNote->get_actual_accidentals() << "\t"
+              << pNote->get_notated_accidentals() << endl;
+        }
+    }
+    return s.str();
+}
+
 
 //=======================================================================================
 // PitchAssigner implementation
@@ -167,6 +253,80 @@ void PitchAssigner::assign_pitch(ImoScore* pScore)
     }
 }
 
+//---------------------------------------------------------------------------------------
+void PitchAssigner::update_pitch(ImoScore* pScore, int iInstr, ColStaffObjsEntry* pFirst,
+                                 ColStaffObjsEntry* pLast, bool fKeysUpdated)
+{
+    //Assigns pitch to the notes of instrument iInstr after updating entries
+    //[pFirst, pLast] of the ColStaffObjs table. As barlines reset the accidentals
+    //context to the key signature, notes are processed from the last barline before
+    //the updated entries to the first barline after them, or to the end of the score
+    //if key signatures could have changed. Without key signature the context is not
+    //reset, so all notes are processed.
+
+    if (!pFirst)
+        return;
+
+    int numStaves = pScore->get_instrument(iInstr)->get_num_staves();
+    m_context.assign(numStaves, {0,0,0,0,0,0,0});        //alterations, per staff
+
+    //find last barline before the updated entries and the key signature for it
+    ColStaffObjsEntry* pBarline = pFirst->get_prev();
+    while (pBarline && !(pBarline->num_instrument() == iInstr
+                         && pBarline->imo_object()->is_barline()))
+    {
+        pBarline = pBarline->get_prev();
+    }
+    ImoKeySignature* pKey = nullptr;
+    for (ColStaffObjsEntry* pEntry = pBarline; pEntry && !pKey;
+         pEntry = pEntry->get_prev())
+    {
+        if (pEntry->num_instrument() == iInstr
+            && pEntry->imo_object()->is_key_signature())
+        {
+            pKey = static_cast<ImoKeySignature*>( pEntry->imo_object() );
+        }
+    }
+
+    ColStaffObjsEntry* pEntry = pScore->get_staffobjs_table()->front();
+    if (pKey)
+    {
+        for (int iStaff=0; iStaff < numStaves; ++iStaff)
+            reset_accidentals(pKey, iStaff);
+        pEntry = pBarline->get_next();
+    }
+
+    bool fUpdatedPassed = false;
+    for (; pEntry; pEntry = pEntry->get_next())
+    {
+        if (pEntry->num_instrument() == iInstr)
+        {
+            ImoStaffObj* pSO = pEntry->imo_object();
+            if (pSO->is_note())
+            {
+                compute_pitch(static_cast<ImoNote*>(pSO), pEntry->staff());
+            }
+            else if (pSO->is_barline())
+            {
+                if (fUpdatedPassed && pKey && !fKeysUpdated)
+                    break;      //next notes are not affected
+
+                for (int iStaff=0; iStaff < numStaves; ++iStaff)
+                    reset_accidentals(pKey, iStaff);
+            }
+            else if (pSO->is_key_signature())
+            {
+                pKey = static_cast<ImoKeySignature*>( pSO );
+                for (int iStaff=0; iStaff < numStaves; ++iStaff)
+                    reset_accidentals(pKey, iStaff);
+            }
+        }
+
+        if (pEntry == pLast)
+            fUpdatedPassed = true;
+    }
+}
+
 //---------------------------------------------------------------------------------------
 void PitchAssigner::compute_notated_accidentals(ImoNote* pNote, int context)
 {
@@ -582,40 +742,103 @@ void MeasuresTableBuilder::build(ImoScore* pScore)
     ColStaffObjsIterator it = pCSO->begin();
     while (it != pCSO->end())
     {
-        ColStaffObjsEntry* pCsoEntry = *it;
-        int iInstr = pCsoEntry->num_instrument();
-        ImoStaffObj* pSO = pCsoEntry->imo_object();
+        add_to_measures(pScore, *it);
 
-        //if first entry for the instrument create measures table and first measure
-        if (m_instruments[iInstr] == nullptr)
-        {
-            ImoInstrument* pInstr = pScore->get_instrument(iInstr);
-            start_measures_table_for(iInstr, pInstr, pCsoEntry);
-        }
+        //advance to next entry
+        ++it;
+    }
+}
 
-        //start new measure if no current measure
-        if (m_measures[iInstr] == nullptr)
-            start_new_measure(iInstr, pCsoEntry);
+//---------------------------------------------------------------------------------------
+void MeasuresTableBuilder::update(ImoScore* pScore, int iInstr, ColStaffObjsEntry* pFirst)
+{
+    //Updates the measures table for instrument iInstr after updating entries of the
+    //ColStaffObjs table, starting with pFirst. Measures ending before pFirst are kept
+    //and next ones are created again.
 
-        //if Time Signature update beat duration
-        if (pSO->is_time_signature())
-        {
-            ImoTimeSignature* pTS = static_cast<ImoTimeSignature*>(pSO);
-            m_measures[iInstr]->set_implied_beat_duration( pTS->get_beat_duration() );
-            m_measures[iInstr]->set_bottom_ts_beat_duration( pTS->get_ref_note_duration() );
-        }
+    if (!pFirst)
+        return;
 
-        //if not intermediate barline finish current measure
-        if (pSO->is_barline())
+    int numInstrs = pScore->get_num_instruments();
+    m_instruments.assign(numInstrs, nullptr);
+    m_measures.assign(numInstrs, nullptr);
+
+    //find last measure ending before pFirst, and its first entry
+    ColStaffObjsEntry* pEnd = pFirst->get_prev();
+    while (pEnd && !is_end_of_measure(pEnd, iInstr))
+        pEnd = pEnd->get_prev();
+
+    ImoInstrument* pInstr = pScore->get_instrument(iInstr);
+    ImMeasuresTable* pTable = pInstr->get_measures_table();
+    ImMeasuresTableEntry* pMeasure = nullptr;
+    if (pEnd && pTable)
+    {
+        ColStaffObjsEntry* pStart = pEnd;
+        ColStaffObjsEntry* pPrev = pEnd->get_prev();
+        for (; pPrev && !is_end_of_measure(pPrev, iInstr); pPrev = pPrev->get_prev())
         {
-            ImoBarline* pBL = static_cast<ImoBarline*>(pSO);
-            if (!pBL->is_middle())
-                finish_current_measure(iInstr);
+            if (pPrev->num_instrument() == iInstr)
+                pStart = pPrev;
         }
+        pMeasure = pTable->find_measure_starting_with(pStart->imo_object());
+    }
 
-        //advance to next entry
-        ++it;
+    ColStaffObjsEntry* pCsoEntry;
+    if (pMeasure)
+    {
+        pTable->delete_entries_from(pMeasure->get_table_index() + 1);
+        m_instruments[iInstr] = pInstr;
+        pCsoEntry = pEnd->get_next();
+    }
+    else
+    {
+        //create the whole table
+        pCsoEntry = pScore->get_staffobjs_table()->front();
     }
+
+    for (; pCsoEntry; pCsoEntry = pCsoEntry->get_next())
+    {
+        if (pCsoEntry->num_instrument() == iInstr)
+            add_to_measures(pScore, pCsoEntry);
+    }
+}
+
+//---------------------------------------------------------------------------------------
+void MeasuresTableBuilder::add_to_measures(ImoScore* pScore, ColStaffObjsEntry* pCsoEntry)
+{
+    int iInstr = pCsoEntry->num_instrument();
+    ImoStaffObj* pSO = pCsoEntry->imo_object();
+
+    //if first entry for the instrument create measures table and first measure
+    if (m_instruments[iInstr] == nullptr)
+    {
+        ImoInstrument* pInstr = pScore->get_instrument(iInstr);
+        start_measures_table_for(iInstr, pInstr, pCsoEntry);
+    }
+
+    //start new measure if no current measure
+    if (m_measures[iInstr] == nullptr)
+        start_new_measure(iInstr, pCsoEntry);
+
+    //if Time Signature update beat duration
+    if (pSO->is_time_signature())
+    {
+        ImoTimeSignature* pTS = static_cast<ImoTimeSignature*>(pSO);
+        m_measures[iInstr]->set_implied_beat_duration( pTS->get_beat_duration() );
+        m_measures[iInstr]->set_bottom_ts_beat_duration( pTS->get_ref_note_duration() );
+    }
+
+    //if not intermediate barline finish current measure
+    if (is_end_of_measure(pCsoEntry, iInstr))
+        finish_current_measure(iInstr);
+}
+
+//---------------------------------------------------------------------------------------
+bool MeasuresTableBuilder::is_end_of_measure(ColStaffObjsEntry* pCsoEntry, int iInstr)
+{
+    ImoStaffObj* pSO = pCsoEntry->imo_object();
+    return pCsoEntry->num_instrument() == iInstr && pSO->is_barline()
+           && !static_cast<ImoBarline*>(pSO)->is_middle();
 }
 
 //---------------------------------------------------------------------------------------
@@ -624,7 +847,8 @@ void MeasuresTableBuilder::start_measures_table_for(int iInstr, ImoInstrument* p
 {
     m_instruments[iInstr] = pInstr;
 
-    //create measures table
+    //create measures table, replacing previous one
+    delete pInstr->get_measures_table();
     ImMeasuresTable* pTable = LOMSE_NEW ImMeasuresTable();
     pInstr->set_measures_table(pTable);
 
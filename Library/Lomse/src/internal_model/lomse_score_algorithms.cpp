@@ -60,42 +60,32 @@ ImoNote* ScoreAlgorithms::find_possible_end_of_tie(ColStaffObjs* pColStaffObjs,
     // distance (in timepos) is equal to start note duration.
     // The search will fail as soon as we find a rest or a note with different pitch.
 
-    //get target pitch and voice
+    //get target pitch
     FPitch pitch = pStartNote->get_fpitch();
-    int voice = pStartNote->get_voice();
 
-    //define a forwards iterator and find start note
+    //find start note
     ColStaffObjsIterator it = pColStaffObjs->find(pStartNote);
     if (it == pColStaffObjs->end())
         return nullptr;    //pStartNote not found ??????
 
-    int instr = (*it)->num_instrument();
+    //next note/rest in the same instrument and voice
+    ColStaffObjsEntry* pEntry = pColStaffObjs->next_noterest_in_voice(*it);
+    if (pEntry == nullptr)
+        return nullptr;        //no suitable note found
 
-    //do search
-    ++it;
-    while(it != pColStaffObjs->end())
+    ImoStaffObj* pSO = pEntry->imo_object();
+    if (pSO->is_note())
     {
-        ImoStaffObj* pSO = (*it)->imo_object();
-        if ((*it)->num_instrument() == instr
-            && pSO->is_note_rest()
-            && static_cast<ImoNoteRest*>(pSO)->get_voice() == voice)
-        {
-            if (pSO->is_note())
-            {
-                if (static_cast<ImoNote*>(pSO)->get_fpitch() == pitch)
-                    return static_cast<ImoNote*>(pSO);    // candidate found
-                else
-                    // a note in the same voice with different pitch found.
-                    // Imposible to tie
-                    return nullptr;
-            }
-            else
-                // a rest in the same voice found. Imposible to tie
-                return nullptr;
-        }
-        ++it;
+        if (static_cast<ImoNote*>(pSO)->get_fpitch() == pitch)
+            return static_cast<ImoNote*>(pSO);    // candidate found
+        else
+            // a note in the same voice with different pitch found.
+            // Imposible to tie
+            return nullptr;
     }
-    return nullptr;        //no suitable note found
+    else
+        // a rest in the same voice found. Imposible to tie
+        return nullptr;
 }
 
 //---------------------------------------------------------------------------------------
@@ -147,23 +137,10 @@ ImoNoteRest* ScoreAlgorithms::find_noterest_at(ImoScore* pScore,
                                                int instr, int voice, TimeUnits time)
 {
     ColStaffObjs* pColStaffObjs = pScore->get_staffobjs_table();
-    ColStaffObjsIterator it;
-    for (it=pColStaffObjs->begin(); it != pColStaffObjs->end(); ++it)
-    {
-        if (is_greater_time((*it)->time(), time))
-            break;
-        ImoObj* pImo = (*it)->imo_object();
-        if (pImo->is_note_rest())
-        {
-            ImoNoteRest* pNR = static_cast<ImoNoteRest*>(pImo);
-            if ((*it)->num_instrument() == instr)
-            {
-                if (pNR->get_voice() == voice
-                    && !is_greater_time(time, (*it)->time() + pNR->get_duration()) )
-                    return pNR;
-            }
-        }
-    }
+    ColStaffObjsEntry* pEntry = pColStaffObjs->find_noterest_sounding_at(instr, voice,
+                                                                         time);
+    if (pEntry)
+        return static_cast<ImoNoteRest*>( pEntry->imo_object() );
     return nullptr;
 }
 
@@ -173,67 +150,64 @@ list<OverlappedNoteRest*> ScoreAlgorithms::find_and_classify_overlapped_noterest
 {
     list<OverlappedNoteRest*> overlaps;
     ColStaffObjs* pColStaffObjs = pScore->get_staffobjs_table();
-    ColStaffObjsIterator it;
-    for (it=pColStaffObjs->begin(); it != pColStaffObjs->end(); ++it)
+
+    //notes/rests in this voice ending before 'time' can not overlap
+    ColStaffObjsEntry* pEntry = pColStaffObjs->find_noterest_ending_after(instr, voice,
+                                                                          time);
+    for (; pEntry; pEntry = pColStaffObjs->next_noterest_in_voice(pEntry))
     {
-        ImoObj* pImo = (*it)->imo_object();
-        if (pImo->is_note_rest())
+        ImoNoteRest* pNR = static_cast<ImoNoteRest*>( pEntry->imo_object() );
+        TimeUnits nrTime = pEntry->time();
+        TimeUnits nrDuration = pNR->get_duration();
+        if (is_greater_time(time + duration, nrTime)     //starts before end of inserted one
+            && is_lower_time(time, nrTime + nrDuration)     //ends after start of inserted one
+           )
         {
-            ImoNoteRest* pNR = static_cast<ImoNoteRest*>(pImo);
-            TimeUnits nrTime = (*it)->time();
-            TimeUnits nrDuration = pNR->get_duration();
-            if ((*it)->num_instrument() == instr
-                && pNR->get_voice() == voice
-                && is_greater_time(time + duration, nrTime)     //starts before end of inserted one
-                && is_lower_time(time, nrTime + nrDuration)     //ends after start of inserted one
-               )
+            OverlappedNoteRest* pOV = LOMSE_NEW OverlappedNoteRest(pNR);
+            if (is_equal_time(nrTime, time))
             {
-                OverlappedNoteRest* pOV = LOMSE_NEW OverlappedNoteRest(pNR);
-                if (is_equal_time(nrTime, time))
+                //both start at same time
+                if (is_lower_time(duration, nrDuration))
                 {
-                    //both start at same time
-                    if (is_lower_time(duration, nrDuration))
-                    {
-                        //test 4
-                        pOV->type = k_overlap_at_start;
-                        pOV->overlap = duration;
-                    }
-                    else
-                    {
-                        //test 1
-                        pOV->type = k_overlap_full;
-                        pOV->overlap = nrDuration;
-                    }
+                    //test 4
+                    pOV->type = k_overlap_at_start;
+                    pOV->overlap = duration;
                 }
-                else if (is_lower_time(time, nrTime))
+                else
                 {
-                    //starts after inserted one: overlap at_start or full
-                    pOV->overlap = duration - (nrTime - time);
-                    if (is_lower_time(pOV->overlap, nrDuration))
-                    {
-                        //test 5
-                        pOV->type = k_overlap_at_start;
-                    }
-                    else
-                    {
-                        //test 3
-                        pOV->type = k_overlap_full;
-                        pOV->overlap = nrDuration;
-                    }
+                    //test 1
+                    pOV->type = k_overlap_full;
+                    pOV->overlap = nrDuration;
+                }
+            }
+            else if (is_lower_time(time, nrTime))
+            {
+                //starts after inserted one: overlap at_start or full
+                pOV->overlap = duration - (nrTime - time);
+                if (is_lower_time(pOV->overlap, nrDuration))
+                {
+                    //test 5
+                    pOV->type = k_overlap_at_start;
                 }
                 else
                 {
-                    //starts before inserted one: overlap at_end
-                    //test 2, 3, 5
-                    pOV->overlap = nrDuration - (time - nrTime);
-                    pOV->type = k_overlap_at_end;
+                    //test 3
+                    pOV->type = k_overlap_full;
+                    pOV->overlap = nrDuration;
                 }
-
-                overlaps.push_back(pOV);
             }
-            else if (is_lower_time(time + duration, nrTime))
-                break;
+            else
+            {
+                //starts before inserted one: overlap at_end
+                //test 2, 3, 5
+                pOV->overlap = nrDuration - (time - nrTime);
+                pOV->type = k_overlap_at_end;
+            }
+
+            overlaps.push_back(pOV);
         }
+        else if (is_lower_time(time + duration, nrTime))
+            break;
     }
     return overlaps;
 }
@@ -277,19 +251,10 @@ ColStaffObjsIterator ScoreAlgorithms::find_barline_with_time_lower_or_equal(
             ImoScore* pScore, int UNUSED(instr), TimeUnits maxTime)
 {
     ColStaffObjs* pColStaffObjs = pScore->get_staffobjs_table();
-    ColStaffObjsIterator it = pColStaffObjs->begin();
-    ColStaffObjsIterator itLastBarline = it;
-    for (; it != pColStaffObjs->end(); ++it)
-    {
-        ImoObj* pImo = (*it)->imo_object();
-        if (pImo->is_barline())
-        {
-            if (is_greater_time((*it)->time(), maxTime))
-                break;
-            itLastBarline = it;
-        }
-    }
-    return itLastBarline;
+    ColStaffObjsEntry* pEntry = pColStaffObjs->find_last_barline_not_after(maxTime);
+    if (pEntry)
+        return ColStaffObjsIterator(pEntry);
+    return pColStaffObjs->begin();
 }
 
 //---------------------------------------------------------------------------------------
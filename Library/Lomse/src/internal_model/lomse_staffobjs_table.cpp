@@ -37,6 +37,7 @@
 #include "lomse_im_factory.h"
 
 
+#include <limits>
 #include <sstream>
 using namespace std;
 
@@ -73,30 +74,26 @@ std::string ColStaffObjsEntry::to_string_with_ids()
 //=======================================================================================
 ColStaffObjs::ColStaffObjs()
     : m_numLines(0)
-    , m_numEntries(0)
+    , m_numSorted(0)
     , m_rMissingTime(0.0)
     , m_minNoteDuration(LOMSE_NO_NOTE_DURATION)
-    , m_pFirst(nullptr)
-    , m_pLast(nullptr)
+    , m_pIndex(nullptr)
 {
 }
 
 //---------------------------------------------------------------------------------------
 ColStaffObjs::~ColStaffObjs()
 {
-    ColStaffObjs::iterator it;
-    for (it=begin(); it != end(); ++it)
-        delete *it;
+    delete m_pIndex;
 }
 
 //---------------------------------------------------------------------------------------
 void ColStaffObjs::add_entry(int measure, int instr, int voice, int staff,
-                             ImoStaffObj* pImo)
+                             ImoStaffObj* pImo, int order)
 {
-    ColStaffObjsEntry* pEntry =
-        LOMSE_NEW ColStaffObjsEntry(measure, instr, voice, staff, pImo);
-    add_entry_to_list(pEntry);
-    ++m_numEntries;
+    //entries are placed in order when the table is next accessed
+    m_entries.push_back( ColStaffObjsEntry(measure, instr, voice, staff, pImo, this,
+                                           order) );
 }
 
 //---------------------------------------------------------------------------------------
@@ -116,44 +113,38 @@ string ColStaffObjs::dump(bool fWithIds)
 }
 
 //---------------------------------------------------------------------------------------
-void ColStaffObjs::add_entry_to_list(ColStaffObjsEntry* pEntry)
+string ColStaffObjs::dump_builder_data()
 {
-    if (!m_pFirst)
-    {
-        //first entry
-        m_pFirst = pEntry;
-        m_pLast = pEntry;
-        pEntry->set_prev( nullptr );
-        pEntry->set_next( nullptr );
-        return;
-    }
+    //arrival order and exact time of entries, and saved builder state, for checking
+    //that updated tables are equal to a new one
+    ensure_sorted();
+    stringstream s;
+    s.precision(17);
+    s << "lines=" << m_numLines << ", min.note=" << m_minNoteDuration
+      << ", anacrusis=" << m_rMissingTime << endl;
+
+    vector<ColStaffObjsEntry>::iterator it;
+    for (it = m_entries.begin(); it != m_entries.end(); ++it)
+        s << it->m_instr << "\t" << it->m_order << "\t" << it->time() << endl;
 
-    //insert in list in order
-    ColStaffObjsEntry* pCurrent = m_pLast;
-    while (pCurrent != nullptr)
+    for (size_t i=0; i < m_instrInfo.size(); ++i)
     {
-        if (is_lower_entry(pEntry, pCurrent))
-            pCurrent = pCurrent->get_prev();
-        else
+        ColStaffObjsInstrInfo& info = m_instrInfo[i];
+        s << "instr " << i << ": last new line in measure " << info.lastNewLineMeasure
+          << ", lines=" << info.lines.get_number_of_lines() << "/"
+          << info.lines.num_assigned() << endl;
+        for (size_t m=0; m < info.measures.size(); ++m)
         {
-            //insert after pCurrent
-            ColStaffObjsEntry* pNext = pCurrent->get_next();
-            pEntry->set_prev( pCurrent );
-            pEntry->set_next( pNext );
-            pCurrent->set_next( pEntry );
-            if (pNext == nullptr)
-                m_pLast = pEntry;
-            else
-                pNext->set_prev( pEntry );
-            return;
+            ColStaffObjsMeasureInfo& measure = info.measures[m];
+            s << m << "\t" << (measure.pBarline ? measure.pBarline->get_id() : -1)
+              << "\t" << measure.curTime << "\t" << measure.maxSegmentTime
+              << "\t" << measure.startSegmentTime << "\t" << measure.curVoice
+              << "\t" << measure.order << "\t" << measure.minTime
+              << "\t" << measure.maxTime << "\t" << measure.minNoteDuration
+              << "\t" << measure.fSignatures << endl;
         }
     }
-
-    //it is the first one
-    pEntry->set_prev( nullptr );
-    pEntry->set_next( m_pFirst );
-    m_pFirst->set_prev( pEntry );
-    m_pFirst = pEntry;
+    return s.str();
 }
 
 //---------------------------------------------------------------------------------------
@@ -222,70 +213,386 @@ void ColStaffObjs::delete_entry_for(ImoStaffObj* pSO)
         throw runtime_error("[ColStaffObjs::delete_entry_for] entry not found!");
     }
 
-    ColStaffObjsEntry* pPrev = pEntry->get_prev();
-    ColStaffObjsEntry* pNext = pEntry->get_next();
-    delete pEntry;
-    if (pPrev == nullptr)
+    m_entries.erase(m_entries.begin() + (pEntry - m_entries.data()));
+    --m_numSorted;
+    invalidate_index();
+}
+
+//---------------------------------------------------------------------------------------
+ColStaffObjsEntry* ColStaffObjs::find_entry_for(ImoStaffObj* pSO)
+{
+    int pos = get_index()->find_pos_for(pSO);
+    return (pos < 0 ? nullptr : &m_entries[pos]);
+}
+
+//---------------------------------------------------------------------------------------
+ColStaffObjsEntry* ColStaffObjs::next_noterest_in_voice(ColStaffObjsEntry* pEntry)
+{
+    //Returns the next note/rest in the same instrument and voice than the note/rest
+    //in pEntry, or nullptr if none.
+
+    ColStaffObjsIndex* pIndex = get_index();
+    ImoStaffObj* pSO = pEntry->imo_object();
+    if (!pSO->is_note_rest())
+        return nullptr;
+
+    int voice = static_cast<ImoNoteRest*>(pSO)->get_voice();
+    int pos = pIndex->next_noterest_in_voice(int(pEntry - m_entries.data()),
+                                             pEntry->num_instrument(), voice);
+    return (pos < 0 ? nullptr : &m_entries[pos]);
+}
+
+//---------------------------------------------------------------------------------------
+ColStaffObjsEntry* ColStaffObjs::find_noterest_sounding_at(int instr, int voice,
+                                                           TimeUnits time)
+{
+    //Returns the first note/rest in the given instrument and voice that starts at or
+    //before 'time' and ends at or after it, or nullptr if none.
+
+    int pos = get_index()->find_noterest_sounding_at(instr, voice, time);
+    return (pos < 0 ? nullptr : &m_entries[pos]);
+}
+
+//---------------------------------------------------------------------------------------
+ColStaffObjsEntry* ColStaffObjs::find_noterest_ending_after(int instr, int voice,
+                                                            TimeUnits time)
+{
+    //Returns the first note/rest in the given instrument and voice that ends after
+    //'time', or nullptr if none. Next ones can be found by next_noterest_in_voice().
+
+    int pos = get_index()->find_noterest_ending_after(instr, voice, time);
+    return (pos < 0 ? nullptr : &m_entries[pos]);
+}
+
+//---------------------------------------------------------------------------------------
+ColStaffObjsEntry* ColStaffObjs::find_last_barline_not_after(TimeUnits time)
+{
+    //Returns the last barline, in table order, preceding the first barline with
+    //time greater than 'time', or nullptr if none.
+
+    int pos = get_index()->find_last_barline_not_after(time);
+    return (pos < 0 ? nullptr : &m_entries[pos]);
+}
+
+//---------------------------------------------------------------------------------------
+ColStaffObjsIndex* ColStaffObjs::get_index()
+{
+    ensure_sorted();
+    if (!m_pIndex)
+        m_pIndex = LOMSE_NEW ColStaffObjsIndex(this);
+    return m_pIndex;
+}
+
+//---------------------------------------------------------------------------------------
+void ColStaffObjs::invalidate_index()
+{
+    delete m_pIndex;
+    m_pIndex = nullptr;
+}
+
+//---------------------------------------------------------------------------------------
+bool ColStaffObjs::is_lower_key(const SortKey& a, const SortKey& b)
+{
+    //auxiliary, for sort_table(): order new entries by time
+    return is_lower_time(a.time, b.time);
+}
+
+//---------------------------------------------------------------------------------------
+bool ColStaffObjs::is_lower_arrival(const ColStaffObjsEntry& a,
+                                    const ColStaffObjsEntry& b)
+{
+    //auxiliary, for replace_entries(): order entries as they are added by the builder
+    return a.m_instr < b.m_instr || (a.m_instr == b.m_instr && a.m_order < b.m_order);
+}
+
+//---------------------------------------------------------------------------------------
+void ColStaffObjs::sort_table()
+{
+    merge_entries(m_entries, m_numSorted);
+    m_numSorted = int(m_entries.size());
+    invalidate_index();
+}
+
+//---------------------------------------------------------------------------------------
+void ColStaffObjs::merge_entries(vector<ColStaffObjsEntry>& entries, int numSorted)
+{
+    //Places the entries added after the first numSorted ones. The result must be the
+    //same as inserting each new entry, in the order they were added, by walking back
+    //from the end of the table while is_lower_entry() says it must go before. As
+    //is_lower_entry() only reorders entries with different times by time, this
+    //walk can only stop inside the group of entries having the same time than the
+    //new entry. Therefore:
+    // * new entries are stable sorted by time, and
+    // * merged with the ordered entries, time group by time group. Inside a group,
+    //   new entries are inserted one by one as the walk back would do.
+    //Groups are small (the objects at the same timepos), so this is O(n log n)
+    //instead of the O(n^2) of inserting each entry from the end of the table.
+
+    int numEntries = int(entries.size());
+    vector<SortKey> added;
+    added.reserve(numEntries - numSorted);
+    for (int i = numSorted; i < numEntries; ++i)
+    {
+        SortKey key = { entries[i].time(), i };
+        added.push_back(key);
+    }
+    std::stable_sort(added.begin(), added.end(), is_lower_key);
+
+    vector<ColStaffObjsEntry> table;
+    table.reserve(numEntries);
+    vector<ColStaffObjsEntry*> group;
+    int iOld = 0;
+    size_t iNew = 0;
+    while (iNew < added.size())
+    {
+        TimeUnits time = added[iNew].time;
+
+        //ordered entries before the group
+        while (iOld < numSorted && is_lower_time(entries[iOld].time(), time))
+            table.push_back(entries[iOld++]);
+
+        //ordered entries in the group
+        group.clear();
+        while (iOld < numSorted && is_equal_time(entries[iOld].time(), time))
+            group.push_back(&entries[iOld++]);
+
+        //insert new entries in the group
+        for (; iNew < added.size() && is_equal_time(added[iNew].time, time); ++iNew)
+        {
+            ColStaffObjsEntry* pEntry = &entries[ added[iNew].index ];
+            vector<ColStaffObjsEntry*>::iterator it = group.end();
+            while (it != group.begin() && is_lower_entry(pEntry, *(it - 1)))
+                --it;
+            group.insert(it, pEntry);
+        }
+
+        vector<ColStaffObjsEntry*>::iterator it;
+        for (it = group.begin(); it != group.end(); ++it)
+            table.push_back(**it);
+    }
+    while (iOld < numSorted)
+        table.push_back(entries[iOld++]);
+
+    entries.swap(table);
+}
+
+//---------------------------------------------------------------------------------------
+int ColStaffObjs::replace_entries(int instr, int firstMeasure, int endMeasure,
+                                  int measureShift, int orderShift,
+                                  TimeUnits minTime, TimeUnits maxTime, int* pEnd)
+{
+    //Replaces the entries for instrument 'instr' in measures [firstMeasure, endMeasure)
+    //by the entries added since last sort, and renumbers the entries for next
+    //measures of the instrument. minTime-maxTime is the time range of the replaced
+    //entries; their objects could no longer exist.
+    //Entries in the time range of replaced and new entries are placed again, as
+    //a new table would have them: in arrival order (instrument, order in instrument)
+    //and merged by merge_entries(). Other entries keep their place.
+    //Returns the position of the first placed entry and, in pEnd, the position after
+    //the last one.
+
+    int numEntries = int(m_entries.size());
+    for (int i = m_numSorted; i < numEntries; ++i)
     {
-        //removing the head of the list
-        m_pFirst = pNext;
-        if (pNext)
-            pNext->set_prev(nullptr);
+        TimeUnits time = m_entries[i].time();
+        minTime = min(minTime, time);
+        maxTime = max(maxTime, time);
     }
-    else if (pNext == nullptr)
+
+    //remaining entries keep table order
+    vector<ColStaffObjsEntry> table;
+    table.reserve(numEntries);
+    for (int i = 0; i < m_numSorted; ++i)
     {
-        //removing the tail of the list
-        m_pLast = pPrev;
-        pPrev->set_next(nullptr);
+        ColStaffObjsEntry& entry = m_entries[i];
+        if (entry.m_instr == instr && entry.m_measure >= firstMeasure)
+        {
+            if (entry.m_measure < endMeasure)
+                continue;
+            entry.m_measure += measureShift;
+            entry.m_order += orderShift;
+        }
+        table.push_back(entry);
     }
-    else
+
+    //range to place again, extended to whole time groups
+    int first = 0;
+    int last = int(table.size());
+    while (first < last)
     {
-        //removing intermediate node
-        pPrev->set_next( pNext );
-        pNext->set_prev( pPrev );
+        int middle = (first + last) / 2;
+        if (is_lower_time(table[middle].time(), minTime))
+            first = middle + 1;
+        else
+            last = middle;
     }
-    --m_numEntries;
+    int end = first;
+    last = int(table.size());
+    while (end < last)
+    {
+        int middle = (end + last) / 2;
+        if (is_lower_time(maxTime, table[middle].time()))
+            last = middle;
+        else
+            end = middle + 1;
+    }
+    while (first > 0 && first < int(table.size())
+           && is_equal_time(table[first-1].time(), table[first].time()))
+        --first;
+    while (end > first && end < int(table.size())
+           && is_equal_time(table[end].time(), table[end-1].time()))
+        ++end;
+
+    vector<ColStaffObjsEntry> placed(table.begin() + first, table.begin() + end);
+    placed.insert(placed.end(), m_entries.begin() + m_numSorted, m_entries.end());
+    std::sort(placed.begin(), placed.end(), is_lower_arrival);
+    merge_entries(placed, 0);
+
+    table.erase(table.begin() + first, table.begin() + end);
+    table.insert(table.begin() + first, placed.begin(), placed.end());
+    m_entries.swap(table);
+    m_numSorted = int(m_entries.size());
+    invalidate_index();
+
+    *pEnd = first + int(placed.size());
+    return first;
 }
 
-//---------------------------------------------------------------------------------------
-ColStaffObjsEntry* ColStaffObjs::find_entry_for(ImoStaffObj* pSO)
+
+
+//=======================================================================================
+// ColStaffObjsIndex implementation
+//=======================================================================================
+ColStaffObjsIndex::ColStaffObjsIndex(ColStaffObjs* pColStaffObjs)
 {
-    ColStaffObjs::iterator it;
-    for (it=begin(); it != end(); ++it)
+    vector<ColStaffObjsEntry>& entries = pColStaffObjs->m_entries;
+    int numEntries = int(entries.size());
+    m_posForImo.reserve(numEntries);
+    m_posInVoice.assign(numEntries, -1);
+
+    for (int pos = 0; pos < numEntries; ++pos)
     {
-        if ((*it)->imo_object() == pSO)
-            return *it;
+        ColStaffObjsEntry& entry = entries[pos];
+        ImoStaffObj* pSO = entry.imo_object();
+        m_posForImo.insert( make_pair(pSO, pos) );
+
+        if (pSO->is_note_rest())
+        {
+            ImoNoteRest* pNR = static_cast<ImoNoteRest*>(pSO);
+            vector<TimedEntry>& voice =
+                m_voices[ make_pair(entry.num_instrument(), pNR->get_voice()) ];
+
+            TimedEntry data;
+            data.time = entry.time();
+            data.maxEnd = data.time + pNR->get_duration();
+            data.pos = pos;
+            if (!voice.empty())
+                data.maxEnd = max(data.maxEnd, voice.back().maxEnd);
+
+            m_posInVoice[pos] = int(voice.size());
+            voice.push_back(data);
+        }
+        else if (pSO->is_barline())
+        {
+            TimedEntry data;
+            data.time = entry.time();
+            data.maxEnd = data.time;
+            data.pos = pos;
+            m_barlines.push_back(data);
+        }
     }
-    return nullptr;
 }
 
 //---------------------------------------------------------------------------------------
-void ColStaffObjs::sort_table()
+int ColStaffObjsIndex::find_pos_for(ImoStaffObj* pSO) const
+{
+    unordered_map<ImoStaffObj*, int>::const_iterator it = m_posForImo.find(pSO);
+    return (it != m_posForImo.end() ? it->second : -1);
+}
+
+//---------------------------------------------------------------------------------------
+int ColStaffObjsIndex::next_noterest_in_voice(int pos, int instr, int voice) const
 {
-    //The table is created with entries in order. But edition operations forces to
-    //reorder entries. The main requirement for the sort algorithm is:
-    // * stable (preserve order of elements with equal keys)
-    //The chosen algorithm is the insertion sort, that also has some advantages:
-    // * good performance when table is nearly ordered
-    // * simple to implement and much better performance than other simple algorithms,
-    //   such as the bubble sort
-    // * in-place sort (does not require extra memory)
+    const vector<TimedEntry>* pVoice = get_voice(instr, voice);
+    if (!pVoice || m_posInVoice[pos] < 0)
+        return -1;
 
-    ColStaffObjsEntry* pUnsorted = m_pFirst;
-    m_pFirst = nullptr;
-    m_pLast = nullptr;
+    size_t i = size_t(m_posInVoice[pos]) + 1;
+    return (i < pVoice->size() ? (*pVoice)[i].pos : -1);
+}
 
-    while (pUnsorted != nullptr)
+//---------------------------------------------------------------------------------------
+int ColStaffObjsIndex::find_noterest_sounding_at(int instr, int voice,
+                                                 TimeUnits time) const
+{
+    const vector<TimedEntry>* pVoice = get_voice(instr, voice);
+    if (!pVoice)
+        return -1;
+
+    //maxEnd is not decreasing. The first entry whose maxEnd reaches 'time' is the
+    //first one ending at or after 'time'
+    size_t lo = 0;
+    size_t hi = pVoice->size();
+    while (lo < hi)
     {
-        ColStaffObjsEntry* pCurrent = pUnsorted;
+        size_t mid = (lo + hi) / 2;
+        if (is_greater_time(time, (*pVoice)[mid].maxEnd))
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+
+    //entries are in time order: if this one starts after 'time' all next ones too
+    if (lo == pVoice->size() || is_greater_time((*pVoice)[lo].time, time))
+        return -1;
+    return (*pVoice)[lo].pos;
+}
+
+//---------------------------------------------------------------------------------------
+int ColStaffObjsIndex::find_noterest_ending_after(int instr, int voice,
+                                                  TimeUnits time) const
+{
+    const vector<TimedEntry>* pVoice = get_voice(instr, voice);
+    if (!pVoice)
+        return -1;
 
-        //get next here, as insertion could change next element
-        pUnsorted = pUnsorted->get_next();
+    size_t lo = 0;
+    size_t hi = pVoice->size();
+    while (lo < hi)
+    {
+        size_t mid = (lo + hi) / 2;
+        if (!is_lower_time(time, (*pVoice)[mid].maxEnd))
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    return (lo < pVoice->size() ? (*pVoice)[lo].pos : -1);
+}
 
-        add_entry_to_list(pCurrent);
+//---------------------------------------------------------------------------------------
+int ColStaffObjsIndex::find_last_barline_not_after(TimeUnits time) const
+{
+    size_t lo = 0;
+    size_t hi = m_barlines.size();
+    while (lo < hi)
+    {
+        size_t mid = (lo + hi) / 2;
+        if (!is_greater_time(m_barlines[mid].time, time))
+            lo = mid + 1;
+        else
+            hi = mid;
     }
+    return (lo > 0 ? m_barlines[lo - 1].pos : -1);
 }
 
+//---------------------------------------------------------------------------------------
+const vector<ColStaffObjsIndex::TimedEntry>* ColStaffObjsIndex::get_voice(int instr,
+                                                                  int voice) const
+{
+    map<VoiceKey, vector<TimedEntry> >::const_iterator it =
+        m_voices.find( make_pair(instr, voice) );
+    return (it != m_voices.end() ? &(it->second) : nullptr);
+}
 
 
 //=======================================================================================
@@ -302,6 +609,39 @@ ColStaffObjs* ColStaffObjsBuilder::build(ImoScore* pScore)
     return pColStaffObjs;
 }
 
+//---------------------------------------------------------------------------------------
+bool ColStaffObjsBuilder::update(ImoScore* pScore, int iInstr, int firstMeasure,
+                                 int lastMeasure)
+{
+    //Updates the table after changes in the staffobjs of instrument iInstr that are
+    //restricted to measures [firstMeasure, lastMeasure], numbered as in the table
+    //before the changes. Measures before firstMeasure, including the barline ending
+    //the previous measure, must not have been modified.
+    //Returns false if the table can not be updated. In this case the table is no
+    //longer valid and must be rebuilt.
+
+    m_pFirstUpdated = nullptr;
+    m_pLastUpdated = nullptr;
+    m_fSignaturesUpdated = false;
+
+    ColStaffObjs* pColStaffObjs = pScore->get_staffobjs_table();
+    if (!pColStaffObjs)
+        return false;
+
+    ColStaffObjsBuilderEngine* builder = create_builder_engine(pScore);
+    bool fUpdated = builder->do_update(pColStaffObjs, iInstr, firstMeasure, lastMeasure);
+    if (fUpdated && builder->first_updated() < builder->end_updated())
+    {
+        m_pFirstUpdated = &pColStaffObjs->m_entries[ builder->first_updated() ];
+        m_pLastUpdated = &pColStaffObjs->m_entries[ builder->end_updated() - 1 ];
+        m_fSignaturesUpdated = builder->signatures_updated();
+    }
+
+    delete builder;
+
+    return fUpdated;
+}
+
 //---------------------------------------------------------------------------------------
 ColStaffObjsBuilderEngine* ColStaffObjsBuilder::create_builder_engine(ImoScore* pScore)
 {
@@ -329,6 +669,7 @@ void ColStaffObjsBuilderEngine::create_table()
 {
     initializations();
     int totalInstruments = m_pImScore->get_num_instruments();
+    m_pColStaffObjs->m_instrInfo.resize(totalInstruments);
     for (int instr = 0; instr < totalInstruments; instr++)
     {
         create_entries(instr);
@@ -337,6 +678,187 @@ void ColStaffObjsBuilderEngine::create_table()
     collect_anacrusis_info();
 }
 
+//---------------------------------------------------------------------------------------
+void ColStaffObjsBuilderEngine::create_entries(int nInstr)
+{
+    ColStaffObjsInstrInfo& info = m_pColStaffObjs->m_instrInfo[nInstr];
+    info.lastNewLineMeasure = -1;
+
+    ImoInstrument* pInstr = m_pImScore->get_instrument(nInstr);
+    ImoMusicData* pMusicData = pInstr->get_musicdata();
+    if (!pMusicData)
+        return;
+
+    reset_counters();
+    m_nCurOrder = 0;
+    m_lastNewLineMeasure = -1;
+    m_pMeasures = &info.measures;
+    start_measure(nullptr);
+
+    ImoObj::children_iterator it;
+    for (it = pMusicData->begin(); it != pMusicData->end(); ++it)
+        add_entries_for(*it, nInstr);
+
+    info.lines = m_lines;
+    info.lastNewLineMeasure = m_lastNewLineMeasure;
+}
+
+//---------------------------------------------------------------------------------------
+bool ColStaffObjsBuilderEngine::do_update(ColStaffObjs* pColStaffObjs, int nInstr,
+                                          int firstMeasure, int lastMeasure)
+{
+    //Rebuilds the entries of instrument nInstr from measure firstMeasure until
+    //finding, after lastMeasure, a barline at which the timing state is the same
+    //than when the table was built. Entries for next measures only need to be
+    //renumbered. Returns false when the saved builder data can not be used or when
+    //the changes require to assign new lines.
+
+    vector<ColStaffObjsInstrInfo>& instrInfo = pColStaffObjs->m_instrInfo;
+    if (nInstr < 0 || nInstr >= int(instrInfo.size())
+        || int(instrInfo.size()) != m_pImScore->get_num_instruments())
+    {
+        return false;
+    }
+
+    ColStaffObjsInstrInfo& info = instrInfo[nInstr];
+    vector<ColStaffObjsMeasureInfo>& oldMeasures = info.measures;
+    int numMeasures = int(oldMeasures.size());
+    if (firstMeasure < 1 || firstMeasure <= info.lastNewLineMeasure
+        || firstMeasure >= numMeasures || lastMeasure < firstMeasure)
+    {
+        return false;
+    }
+
+    ImoMusicData* pMusicData = m_pImScore->get_instrument(nInstr)->get_musicdata();
+    ImoStaffObj* pBarline = oldMeasures[firstMeasure].pBarline;
+    if (!pMusicData || !pBarline || pBarline->get_parent() != pMusicData)
+        return false;
+
+    //restore state at start of firstMeasure
+    m_pColStaffObjs = pColStaffObjs;
+    m_pColStaffObjs->ensure_sorted();
+    m_lines = info.lines;
+    m_lastNewLineMeasure = -1;
+    restore_state(oldMeasures[firstMeasure]);
+    m_nCurMeasure = firstMeasure;
+    m_nCurOrder = oldMeasures[firstMeasure].order;
+    vector<ColStaffObjsMeasureInfo> measures;
+    m_pMeasures = &measures;
+    start_measure(pBarline);
+
+    //rebuild measures. The barline ending lastMeasure could be modified, so the
+    //first candidate for stopping is the one ending next measure
+    int iStop = lastMeasure + 2;
+    ImoObj* pStopBarline = (iStop < numMeasures ? oldMeasures[iStop].pBarline : nullptr);
+    bool fStopped = false;
+    ImoObj::children_iterator it(pBarline);
+    for (++it; it != pMusicData->end() && !fStopped; ++it)
+    {
+        add_entries_for(*it, nInstr);
+        if (m_lastNewLineMeasure >= 0)
+            return false;
+
+        if (*it == pStopBarline)
+        {
+            if (is_same_state(measures.back(), oldMeasures[iStop]))
+                fStopped = true;
+            else
+            {
+                ++iStop;
+                pStopBarline = (iStop < numMeasures ? oldMeasures[iStop].pBarline
+                                                    : nullptr);
+            }
+        }
+    }
+
+    //measures replaced and time range of their entries
+    int endMeasure = (fStopped ? iStop : numMeasures);
+    TimeUnits minTime = numeric_limits<TimeUnits>::max();
+    TimeUnits maxTime = numeric_limits<TimeUnits>::lowest();
+    m_fSignaturesUpdated = false;
+    for (int i = firstMeasure; i < endMeasure; ++i)
+    {
+        minTime = min(minTime, oldMeasures[i].minTime);
+        maxTime = max(maxTime, oldMeasures[i].maxTime);
+        m_fSignaturesUpdated |= oldMeasures[i].fSignatures;
+    }
+    int numRebuilt = int(measures.size()) - (fStopped ? 1 : 0);
+    for (int i = 0; i < numRebuilt; ++i)
+        m_fSignaturesUpdated |= measures[i].fSignatures;
+
+    int measureShift = 0;
+    int orderShift = 0;
+    if (fStopped)
+    {
+        //content of the measure at which the rebuild stopped has not changed
+        ColStaffObjsMeasureInfo& stop = measures.back();
+        stop.minTime = oldMeasures[iStop].minTime;
+        stop.maxTime = oldMeasures[iStop].maxTime;
+        stop.minNoteDuration = oldMeasures[iStop].minNoteDuration;
+        stop.fSignatures = oldMeasures[iStop].fSignatures;
+
+        measureShift = m_nCurMeasure - iStop;
+        orderShift = m_nCurOrder - oldMeasures[iStop].order;
+        for (int i = iStop + 1; i < numMeasures; ++i)
+        {
+            measures.push_back(oldMeasures[i]);
+            measures.back().order += orderShift;
+        }
+    }
+
+    //barlines are ordered by comparing measure numbers, even from different
+    //instruments. Thus, when measures are renumbered all next entries must be placed
+    if (measureShift != 0)
+        maxTime = numeric_limits<TimeUnits>::max();
+
+    m_firstUpdated = m_pColStaffObjs->replace_entries(nInstr, firstMeasure, endMeasure,
+                                                      measureShift, orderShift,
+                                                      minTime, maxTime, &m_endUpdated);
+
+    oldMeasures.erase(oldMeasures.begin() + firstMeasure, oldMeasures.end());
+    oldMeasures.insert(oldMeasures.end(), measures.begin(), measures.end());
+
+    //table info that depends on all entries
+    m_minNoteDuration = LOMSE_NO_NOTE_DURATION;
+    vector<ColStaffObjsInstrInfo>::iterator itI;
+    for (itI = instrInfo.begin(); itI != instrInfo.end(); ++itI)
+    {
+        vector<ColStaffObjsMeasureInfo>::iterator itM;
+        for (itM = itI->measures.begin(); itM != itI->measures.end(); ++itM)
+            m_minNoteDuration = min(m_minNoteDuration, itM->minNoteDuration);
+    }
+    set_min_note_duration();
+    m_pColStaffObjs->set_anacrusis_missing_time(0.0);
+    collect_anacrusis_info();
+
+    return true;
+}
+
+//---------------------------------------------------------------------------------------
+void ColStaffObjsBuilderEngine::start_measure(ImoStaffObj* pBarline)
+{
+    ColStaffObjsMeasureInfo info;
+    info.pBarline = pBarline;
+    save_state(info);
+    info.order = m_nCurOrder;
+    info.minTime = numeric_limits<TimeUnits>::max();
+    info.maxTime = numeric_limits<TimeUnits>::lowest();
+    info.minNoteDuration = LOMSE_NO_NOTE_DURATION;
+    info.fSignatures = false;
+    m_pMeasures->push_back(info);
+}
+
+//---------------------------------------------------------------------------------------
+bool ColStaffObjsBuilderEngine::is_same_state(const ColStaffObjsMeasureInfo& a,
+                                              const ColStaffObjsMeasureInfo& b)
+{
+    //AWARE: exact comparison, so that next times are the same than in a new table
+    return a.curTime == b.curTime
+           && a.maxSegmentTime == b.maxSegmentTime
+           && a.startSegmentTime == b.startSegmentTime
+           && a.curVoice == b.curVoice;
+}
+
 //---------------------------------------------------------------------------------------
 void ColStaffObjsBuilderEngine::collect_anacrusis_info()
 {
@@ -383,7 +905,11 @@ void ColStaffObjsBuilderEngine::collect_anacrusis_info()
 //---------------------------------------------------------------------------------------
 int ColStaffObjsBuilderEngine::get_line_for(int nVoice, int nStaff)
 {
-    return m_lines.get_line_assigned_to(nVoice, nStaff);
+    int numAssigned = m_lines.num_assigned();
+    int line = m_lines.get_line_assigned_to(nVoice, nStaff);
+    if (m_lines.num_assigned() != numAssigned)
+        m_lastNewLineMeasure = m_nCurMeasure;
+    return line;
 }
 
 //---------------------------------------------------------------------------------------
@@ -403,8 +929,30 @@ void ColStaffObjsBuilderEngine::add_entries_for_key_or_time_signature(ImoObj* pI
     for (int nStaff=0; nStaff < numStaves; nStaff++)
     {
         int nLine = get_line_for(0, nStaff);
-        m_pColStaffObjs->add_entry(m_nCurMeasure, nInstr, nLine, nStaff, pSO);
+        add_entry(nInstr, nLine, nStaff, pSO);
     }
+    m_pMeasures->back().fSignatures = true;
+}
+
+//---------------------------------------------------------------------------------------
+void ColStaffObjsBuilderEngine::add_entry(int nInstr, int nLine, int nStaff,
+                                          ImoStaffObj* pSO)
+{
+    ColStaffObjsMeasureInfo& measure = m_pMeasures->back();
+    TimeUnits time = pSO->get_time();
+    measure.minTime = min(measure.minTime, time);
+    measure.maxTime = max(measure.maxTime, time);
+
+    m_pColStaffObjs->add_entry(m_nCurMeasure, nInstr, nLine, nStaff, pSO,
+                               m_nCurOrder++);
+}
+
+//---------------------------------------------------------------------------------------
+void ColStaffObjsBuilderEngine::update_min_note_duration(TimeUnits duration)
+{
+    m_minNoteDuration = min(m_minNoteDuration, duration);
+    ColStaffObjsMeasureInfo& measure = m_pMeasures->back();
+    measure.minNoteDuration = min(measure.minNoteDuration, duration);
 }
 
 //---------------------------------------------------------------------------------------
@@ -423,39 +971,26 @@ void ColStaffObjsBuilderEngine1x::initializations()
 }
 
 //---------------------------------------------------------------------------------------
-void ColStaffObjsBuilderEngine1x::create_entries(int nInstr)
+void ColStaffObjsBuilderEngine1x::add_entries_for(ImoObj* pImo, int nInstr)
 {
-    ImoInstrument* pInstr = m_pImScore->get_instrument(nInstr);
-    ImoMusicData* pMusicData = pInstr->get_musicdata();
-    if (!pMusicData)
-        return;
-
-    ImoObj::children_iterator it = pMusicData->begin();
-    reset_counters();
-    while(it != pMusicData->end())
+    if (pImo->is_go_back_fwd())
     {
-        if ((*it)->is_go_back_fwd())
-        {
-            ImoGoBackFwd* pGBF = static_cast<ImoGoBackFwd*>(*it);
-            update_time_counter(pGBF);
-            ++it;
+        ImoGoBackFwd* pGBF = static_cast<ImoGoBackFwd*>(pImo);
+        update_time_counter(pGBF);
 
-            //delete_node(pGBF, pMusicData);
-            //CSG: goBack/Fwd nodes can not be removed. They are necessary in score edition
-            //when ColStaffObjs must be rebuild
-        }
-        else if ((*it)->is_key_signature() || (*it)->is_time_signature())
-        {
-            add_entries_for_key_or_time_signature(*it, nInstr);
-            ++it;
-        }
-        else
-        {
-            ImoStaffObj* pSO = static_cast<ImoStaffObj*>(*it);
-            add_entry_for_staffobj(pSO, nInstr);
-            update_measure(pSO);
-            ++it;
-        }
+        //delete_node(pGBF, pMusicData);
+        //CSG: goBack/Fwd nodes can not be removed. They are necessary in score edition
+        //when ColStaffObjs must be rebuild
+    }
+    else if (pImo->is_key_signature() || pImo->is_time_signature())
+    {
+        add_entries_for_key_or_time_signature(pImo, nInstr);
+    }
+    else
+    {
+        ImoStaffObj* pSO = static_cast<ImoStaffObj*>(pImo);
+        add_entry_for_staffobj(pSO, nInstr);
+        update_measure(pSO);
     }
 }
 
@@ -470,10 +1005,10 @@ void ColStaffObjsBuilderEngine1x::add_entry_for_staffobj(ImoObj* pImo, int nInst
     {
         ImoNoteRest* pNR = static_cast<ImoNoteRest*>(pSO);
         nVoice = pNR->get_voice();
-        m_minNoteDuration = min(m_minNoteDuration, pNR->get_duration());
+        update_min_note_duration(pNR->get_duration());
     }
     int nLine = get_line_for(nVoice, nStaff);
-    m_pColStaffObjs->add_entry(m_nCurMeasure, nInstr, nLine, nStaff, pSO);
+    add_entry(nInstr, nLine, nStaff, pSO);
 }
 
 //---------------------------------------------------------------------------------------
@@ -519,6 +1054,7 @@ void ColStaffObjsBuilderEngine1x::update_measure(ImoStaffObj* pSO)
         ++m_nCurMeasure;
         m_rMaxSegmentTime = 0.0;
         m_rStartSegmentTime = m_rCurTime;
+        start_measure(pSO);
     }
 }
 
@@ -553,6 +1089,23 @@ void ColStaffObjsBuilderEngine1x::prepare_for_next_instrument()
     m_lines.new_instrument();
 }
 
+//---------------------------------------------------------------------------------------
+void ColStaffObjsBuilderEngine1x::save_state(ColStaffObjsMeasureInfo& info)
+{
+    info.curTime = m_rCurTime;
+    info.maxSegmentTime = m_rMaxSegmentTime;
+    info.startSegmentTime = m_rStartSegmentTime;
+    info.curVoice = 0;
+}
+
+//---------------------------------------------------------------------------------------
+void ColStaffObjsBuilderEngine1x::restore_state(const ColStaffObjsMeasureInfo& info)
+{
+    m_rCurTime = info.curTime;
+    m_rMaxSegmentTime = info.maxSegmentTime;
+    m_rStartSegmentTime = info.startSegmentTime;
+}
+
 
 
 //=======================================================================================
@@ -566,28 +1119,18 @@ void ColStaffObjsBuilderEngine2x::initializations()
 }
 
 //---------------------------------------------------------------------------------------
-void ColStaffObjsBuilderEngine2x::create_entries(int nInstr)
+void ColStaffObjsBuilderEngine2x::add_entries_for(ImoObj* pImo, int nInstr)
 {
-    ImoInstrument* pInstr = m_pImScore->get_instrument(nInstr);
-    ImoMusicData* pMusicData = pInstr->get_musicdata();
-    if (!pMusicData)
-        return;
-
-    reset_counters();
-    ImoObj::children_iterator it;
-    for(it = pMusicData->begin(); it != pMusicData->end(); ++it)
+    if (pImo->is_key_signature() || pImo->is_time_signature())
     {
-        if ((*it)->is_key_signature() || (*it)->is_time_signature())
-        {
-            add_entries_for_key_or_time_signature(*it, nInstr);
-        }
-        else
-        {
-            ImoStaffObj* pSO = static_cast<ImoStaffObj*>(*it);
-            add_entry_for_staffobj(pSO, nInstr);
-            if (pSO->is_barline())
-                update_measure();
-        }
+        add_entries_for_key_or_time_signature(pImo, nInstr);
+    }
+    else
+    {
+        ImoStaffObj* pSO = static_cast<ImoStaffObj*>(pImo);
+        add_entry_for_staffobj(pSO, nInstr);
+        if (pSO->is_barline())
+            update_measure(pSO);
     }
 }
 
@@ -610,7 +1153,7 @@ void ColStaffObjsBuilderEngine2x::add_entry_for_staffobj(ImoObj* pImo, int nInst
         nVoice = m_curVoice;
 
     int nLine = get_line_for(nVoice, nStaff);
-    m_pColStaffObjs->add_entry(m_nCurMeasure, nInstr, nLine, nStaff, pSO);
+    add_entry(nInstr, nLine, nStaff, pSO);
 }
 
 //---------------------------------------------------------------------------------------
@@ -644,7 +1187,7 @@ void ColStaffObjsBuilderEngine2x::determine_timepos(ImoStaffObj* pSO)
         m_rCurTime[voice] += duration;
 
         if (duration > 0.0)
-            m_minNoteDuration = min(m_minNoteDuration, duration);
+            update_min_note_duration(duration);
     }
     else if (pSO->is_barline())
     {
@@ -660,11 +1203,12 @@ void ColStaffObjsBuilderEngine2x::determine_timepos(ImoStaffObj* pSO)
 }
 
 //---------------------------------------------------------------------------------------
-void ColStaffObjsBuilderEngine2x::update_measure()
+void ColStaffObjsBuilderEngine2x::update_measure(ImoStaffObj* pBarline)
 {
     ++m_nCurMeasure;
     m_rStartSegmentTime = m_rMaxSegmentTime;
     m_rCurTime.assign(k_max_voices, m_rMaxSegmentTime);
+    start_measure(pBarline);
 }
 
 //---------------------------------------------------------------------------------------
@@ -674,6 +1218,25 @@ void ColStaffObjsBuilderEngine2x::prepare_for_next_instrument()
     m_curVoice = 0;
 }
 
+//---------------------------------------------------------------------------------------
+void ColStaffObjsBuilderEngine2x::save_state(ColStaffObjsMeasureInfo& info)
+{
+    //at measure start all voices are at the same time
+    info.curTime = m_rCurTime[0];
+    info.maxSegmentTime = m_rMaxSegmentTime;
+    info.startSegmentTime = m_rStartSegmentTime;
+    info.curVoice = m_curVoice;
+}
+
+//---------------------------------------------------------------------------------------
+void ColStaffObjsBuilderEngine2x::restore_state(const ColStaffObjsMeasureInfo& info)
+{
+    m_rCurTime.assign(k_max_voices, info.curTime);
+    m_rMaxSegmentTime = info.maxSegmentTime;
+    m_rStartSegmentTime = info.startSegmentTime;
+    m_curVoice = info.curVoice;
+}
+
 
 
 //=======================================================================================
@@ -171,6 +171,7 @@ int Image::get_bits_per_pixel()
         case k_pix_format_argb64:   return 64;   // A-R-G-B, native MAC format
         case k_pix_format_abgr64:   return 64;   // A-B-G-R, one byte per color component
         case k_pix_format_bgra64:   return 64;   // B-G-R-A, native win32 BMP format
+        case k_pix_format_bgra32_pre:   return 32;   // B-G-R-A, premultiplied alpha
     }
     return 0;       //compiler happy
 }
@@ -203,6 +204,7 @@ bool Image::has_alpha()
         case k_pix_format_argb64:       // A-R-G-B, native MAC format
         case k_pix_format_abgr64:       // A-B-G-R, one byte per color component
         case k_pix_format_bgra64:       // B-G-R-A, native win32 BMP format
+        case k_pix_format_bgra32_pre:   // B-G-R-A, premultiplied alpha
             return true;
         default:
         {
@@ -84,6 +84,7 @@ LibraryScope::LibraryScope(ostream& reporter, LomseDoorway* pDoorway)
     , m_sFontsPath(LOMSE_FONTS_PATH)
     , m_pMusicGlyphs(nullptr)      //lazzy instantiation. Singleton scope.
     , m_fReplaceLocalMetronome(false)
+    , m_fUseImoArena(false)
     , m_importOptions()
     , m_fJustifySystems(true)
     , m_fDumpColumnTables(false)
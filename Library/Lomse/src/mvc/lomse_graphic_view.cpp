@@ -581,6 +581,20 @@ void GraphicView::redraw_bitmap() //, RepaintOptions& opt)
     draw_all();
 }
 
+//---------------------------------------------------------------------------------------
+void GraphicView::redraw_visual_effects()
+{
+    if (m_pRenderBuf)
+    {
+        LOMSE_LOG_DEBUG(Logger::k_render, string(""));
+
+        m_pInteractor->timing_visual_effects_start();
+        m_pOverlaysGenerator->on_new_background();
+        draw_all_visual_effects();
+        m_pInteractor->timing_renderization_end();
+    }
+}
+
 //---------------------------------------------------------------------------------------
 void GraphicView::show_caret()
 {
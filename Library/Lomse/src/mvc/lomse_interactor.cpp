@@ -958,6 +958,17 @@ void Interactor::redraw_bitmap()
     m_fViewParamsChanged = false;
 }
 
+//---------------------------------------------------------------------------------------
+void Interactor::redraw_visual_effects()
+{
+    LOMSE_LOG_DEBUG(Logger::k_mvc, string(""));
+
+    GraphicView* pGView = dynamic_cast<GraphicView*>(m_pView);
+    if (pGView)
+        pGView->redraw_visual_effects();
+    m_fViewParamsChanged = false;
+}
+
 //---------------------------------------------------------------------------------------
 void Interactor::request_window_update()
 {
@@ -67,7 +67,7 @@ public:
             return Document::k_format_ldp;
         else if (ext == "lmd")
             return Document::k_format_lmd;
-        else if (ext == "xml" || ext == "musicxml")
+        else if (ext == "xml" || ext == "musicxml" || ext == "mxl")
             return Document::k_format_mxl;
         else if (ext == "mnx")
             return Document::k_format_mnx;
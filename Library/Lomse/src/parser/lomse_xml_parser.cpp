@@ -28,13 +28,35 @@
 //---------------------------------------------------------------------------------------
 
 #include "lomse_xml_parser.h"
+#include "lomse_file_system.h"
+#include "lomse_logger.h"
 
 #include <iostream>
 #include <ostream>
 #include <sstream>
+#include <stdexcept>
 #include <vector>
+#include <cstring>      //memchr, strlen
 using namespace std;
 
+#if (LOMSE_PLATFORM_WIN32 == 1)
+    #ifndef WIN32_LEAN_AND_MEAN
+        #define WIN32_LEAN_AND_MEAN
+    #endif
+    #ifndef NOMINMAX
+        #define NOMINMAX
+    #endif
+    #ifndef NOGDI
+        #define NOGDI
+    #endif
+    #include <windows.h>
+#else
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
 
 ////---------------------------------------------------------------------------------------
 ////AWARE: Microsoft deprecated fopen() but the "security enhanced" new function
@@ -122,6 +144,143 @@ ptrdiff_t XmlNode::offset()
 }
 
 
+//=======================================================================================
+// MappedFile: a file mapped in memory, read-only or with copy-on-write access. In the
+// later case, the parser writes into the mapped pages but the file is never modified
+//=======================================================================================
+class MappedFile
+{
+protected:
+    char* m_data;
+    size_t m_size;
+#if (LOMSE_PLATFORM_WIN32 == 1)
+    HANDLE m_hFile;
+    HANDLE m_hMapping;
+#endif
+
+public:
+    MappedFile()
+        : m_data(nullptr)
+        , m_size(0)
+#if (LOMSE_PLATFORM_WIN32 == 1)
+        , m_hFile(INVALID_HANDLE_VALUE)
+        , m_hMapping(nullptr)
+#endif
+    {
+    }
+
+    ~MappedFile() { close(); }
+
+    inline char* data() { return m_data; }
+    inline size_t size() { return m_size; }
+
+#if (LOMSE_PLATFORM_WIN32 == 1)
+    //-----------------------------------------------------------------------------------
+    bool open(const string& filename, bool fWritable=true)
+    {
+        m_hFile = CreateFileA(filename.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                              OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+        if (m_hFile == INVALID_HANDLE_VALUE)
+            return false;
+
+        LARGE_INTEGER size;
+        if (!GetFileSizeEx(m_hFile, &size) || size.QuadPart == 0)
+        {
+            close();
+            return false;
+        }
+        m_size = size_t(size.QuadPart);
+
+        m_hMapping = CreateFileMappingA(m_hFile, nullptr,
+                                        (fWritable ? PAGE_WRITECOPY : PAGE_READONLY),
+                                        0, 0, nullptr);
+        if (m_hMapping)
+            m_data = static_cast<char*>( MapViewOfFile(m_hMapping,
+                                            (fWritable ? FILE_MAP_COPY : FILE_MAP_READ),
+                                            0, 0, 0) );
+        if (!m_data)
+        {
+            close();
+            return false;
+        }
+        return true;
+    }
+
+    //-----------------------------------------------------------------------------------
+    void close()
+    {
+        if (m_data)
+            UnmapViewOfFile(m_data);
+        if (m_hMapping)
+            CloseHandle(m_hMapping);
+        if (m_hFile != INVALID_HANDLE_VALUE)
+            CloseHandle(m_hFile);
+        m_data = nullptr;
+        m_size = 0;
+        m_hMapping = nullptr;
+        m_hFile = INVALID_HANDLE_VALUE;
+    }
+
+    //-----------------------------------------------------------------------------------
+    void discard(size_t UNUSED(start), size_t UNUSED(end))
+    {
+        //no portable way of dropping private copies of the pages. Ignored
+    }
+
+#else
+    //-----------------------------------------------------------------------------------
+    bool open(const string& filename, bool fWritable=true)
+    {
+        int fd = ::open(filename.c_str(), O_RDONLY);
+        if (fd < 0)
+            return false;
+
+        struct stat st;
+        if (fstat(fd, &st) != 0 || st.st_size == 0)
+        {
+            ::close(fd);
+            return false;
+        }
+        m_size = size_t(st.st_size);
+
+        //private mapping: pages modified by the parser become private copies
+        int prot = (fWritable ? PROT_READ | PROT_WRITE : PROT_READ);
+        void* data = mmap(nullptr, m_size, prot, MAP_PRIVATE, fd, 0);
+        ::close(fd);
+        if (data == MAP_FAILED)
+        {
+            m_size = 0;
+            return false;
+        }
+        m_data = static_cast<char*>(data);
+        madvise(m_data, m_size, MADV_SEQUENTIAL);
+        return true;
+    }
+
+    //-----------------------------------------------------------------------------------
+    void close()
+    {
+        if (m_data)
+            munmap(m_data, m_size);
+        m_data = nullptr;
+        m_size = 0;
+    }
+
+    //-----------------------------------------------------------------------------------
+    void discard(size_t start, size_t end)
+    {
+        //drop the private copies of the pages fully contained in [start, end)
+        size_t page = size_t(sysconf(_SC_PAGESIZE));
+        start = (start + page - 1) / page * page;
+        end = end / page * page;
+        if (start < end)
+            madvise(m_data + start, end - start, MADV_DONTNEED);
+    }
+#endif
+
+};
+
+
 //=======================================================================================
 // XmlParser implementation
 //=======================================================================================
@@ -130,12 +289,45 @@ XmlParser::XmlParser(ostream& reporter)
     , m_root()
     , m_errorOffset(0)
     , m_fOffsetDataReady(false)
+    , m_pMappedFile(nullptr)
 {
 }
 
 //---------------------------------------------------------------------------------------
 XmlParser::~XmlParser()
 {
+    close_mapped_file();
+}
+
+//---------------------------------------------------------------------------------------
+void XmlParser::close_mapped_file()
+{
+    //the tree points to the mapped text. Must be destroyed before unmapping the file
+    if (m_pMappedFile)
+    {
+        m_doc.reset();
+        m_root.m_node = pugi::xml_node();
+        delete m_pMappedFile;
+        m_pMappedFile = nullptr;
+    }
+}
+
+//---------------------------------------------------------------------------------------
+void XmlParser::clear()
+{
+    close_mapped_file();
+    m_doc.reset();
+    m_root.m_node = pugi::xml_node();
+    m_fOffsetDataReady = false;
+    m_offsetData.clear();
+}
+
+//---------------------------------------------------------------------------------------
+void XmlParser::report_error(const string& msg)
+{
+    m_errorMsg = msg;
+    ++m_numErrors;
+    m_reporter << msg << endl;
 }
 
 //---------------------------------------------------------------------------------------
@@ -153,7 +345,9 @@ void XmlParser::parse_cstring(char* sourceText)
 //---------------------------------------------------------------------------------------
 void XmlParser::parse_file(const std::string& filename, bool UNUSED(fErrorMsg))
 {
+    close_mapped_file();
     m_fOffsetDataReady = false;
+    m_offsetData.clear();
     m_filename = filename;
     pugi::xml_parse_result result = m_doc.load_file(filename.c_str(),
                                                     (pugi::parse_default |
@@ -171,10 +365,106 @@ void XmlParser::parse_file(const std::string& filename, bool UNUSED(fErrorMsg))
 }
 
 //---------------------------------------------------------------------------------------
-void XmlParser::parse_char_string(char* str)
+void XmlParser::parse_mapped_file(const std::string& filename)
 {
+    //Parses the file in place, without copying its content into a buffer. Names and
+    //values in the tree point to the mapped file. Once a node is no longer needed,
+    //release_node() frees the memory used by it and by its text.
+
+    close_mapped_file();
+
+    MappedFile* pFile = LOMSE_NEW MappedFile();
+    if (!pFile->open(filename))
+    {
+        delete pFile;
+        parse_file(filename);
+        return;
+    }
+
+    m_pMappedFile = pFile;
     m_fOffsetDataReady = false;
+    m_offsetData.clear();
+    m_filename = filename;
+    pugi::xml_parse_result result = m_doc.load_buffer_inplace(pFile->data(), pFile->size(),
+                                                    (pugi::parse_default |
+                                                     pugi::parse_declaration)
+                                                   );
+
+    if (!result)
+    {
+        m_errorMsg = string(result.description());
+        m_errorOffset = int(result.offset);
+    }
+    find_root();
+}
+
+//---------------------------------------------------------------------------------------
+void XmlParser::parse_input_stream(InputStream* pFile, size_t size)
+{
+    //Reads the data directly into a buffer owned by the tree and parses it in place.
+    //Thus, there is only one copy of the source text in memory
+
+    close_mapped_file();
     m_filename.clear();
+
+    unsigned char* buffer = static_cast<unsigned char*>(
+                                pugi::get_memory_allocation_function()(size + 1) );
+    if (buffer == nullptr)
+    {
+        LOMSE_LOG_ERROR("Error allocating memory for xml source");
+        throw std::runtime_error("[XmlParser::parse_input_stream] error allocating memory");
+    }
+
+    size_t numBytes = 0;
+    if (size > 0 && !pFile->eof())
+        numBytes = size_t( pFile->read(buffer, long(size)) );
+
+    //parsing in place modifies the buffer. Line numbers must be located before
+    build_offset_data(reinterpret_cast<const char*>(buffer), numBytes);
+
+    pugi::xml_parse_result result = m_doc.load_buffer_inplace_own(buffer, numBytes,
+                                                    (pugi::parse_default |
+                                                     pugi::parse_declaration)
+                                                   );
+
+    if (!result)
+    {
+        m_errorMsg = string(result.description());
+        m_errorOffset = int(result.offset);
+    }
+    find_root();
+}
+
+//---------------------------------------------------------------------------------------
+void XmlParser::release_node(XmlNode* node)
+{
+    pugi::xml_node xnode = node->m_node;
+    pugi::xml_node parent = xnode.parent();
+    if (!parent)
+        return;
+
+    //text of the node goes from its start to the start of next node
+    if (m_pMappedFile)
+    {
+        ptrdiff_t start = xnode.offset_debug();
+        ptrdiff_t end = ptrdiff_t(m_pMappedFile->size());
+        pugi::xml_node next = xnode.next_sibling();
+        if (next)
+            end = next.offset_debug();
+        if (start >= 0 && end > start)
+            m_pMappedFile->discard(size_t(start), size_t(end));
+    }
+
+    parent.remove_child(xnode);
+}
+
+//---------------------------------------------------------------------------------------
+void XmlParser::parse_char_string(char* str)
+{
+    //source text is not kept after parsing. Line numbers must be located now
+    close_mapped_file();
+    m_filename.clear();
+    build_offset_data(str, strlen(str));
     pugi::xml_parse_result result = m_doc.load_string(str, (pugi::parse_default |
                                                             //pugi::parse_trim_pcdata |
                                                             //pugi::parse_wnorm_attribute |
@@ -206,7 +496,22 @@ void XmlParser::find_root()
 }
 
 //---------------------------------------------------------------------------------------
-bool XmlParser::build_offset_data(const char* filename)
+bool XmlParser::build_offset_data(const string& filename)
+{
+    //The parsed buffer can not be used: parsing in place replaces some chars, such as
+    //line breaks after element names, by string terminators. Therefore, the
+    //original file is mapped again, read-only, and shared with the system cache.
+
+    MappedFile file;
+    if (!file.open(filename, false))
+        return false;
+
+    build_offset_data(file.data(), file.size());
+    return true;
+}
+
+//---------------------------------------------------------------------------------------
+void XmlParser::build_offset_data(const char* text, size_t size)
 {
     //AWARE:
     // * Windows and DOS use a pair of CR (\r) and LF (\n) chars to end lines
@@ -219,27 +524,18 @@ bool XmlParser::build_offset_data(const char* filename)
 
     m_offsetData.clear();
 
-    FILE* f = fopen(filename, "rb");
-    if (!f)
-        return false;
-
-    ptrdiff_t offset = 0;
-
-    char buffer[1024];
-    size_t size;
-
-    while ((size = fread(buffer, 1, sizeof(buffer), f)) > 0)
+    const char* end = text + size;
+    const char* pos = text;
+    while (pos < end)
     {
-        for (size_t i = 0; i < size; ++i)
-            if (buffer[i] == '\n')
-                m_offsetData.push_back(offset + i);
-
-        offset += size;
+        pos = static_cast<const char*>( memchr(pos, '\n', size_t(end - pos)) );
+        if (pos == nullptr)
+            break;
+        m_offsetData.push_back(pos - text);
+        ++pos;
     }
 
-    fclose(f);
-
-    return true;
+    m_fOffsetDataReady = true;
 }
 
 //---------------------------------------------------------------------------------------
@@ -256,9 +552,11 @@ std::pair<int, int> XmlParser::get_location(ptrdiff_t offset)
 //---------------------------------------------------------------------------------------
 int XmlParser::get_line_number(XmlNode* node)
 {
+    std::lock_guard<std::mutex> lock(m_offsetMutex);
+
     ptrdiff_t offset = node->offset();
     if (!m_fOffsetDataReady && !m_filename.empty())
-        m_fOffsetDataReady = build_offset_data(m_filename.c_str());
+        m_fOffsetDataReady = build_offset_data(m_filename);
 
     if ( m_fOffsetDataReady)
     {
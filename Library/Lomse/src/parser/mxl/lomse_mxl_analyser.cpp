@@ -61,6 +61,11 @@
 #include <vector>
 #include <algorithm>   // for find
 #include <regex>
+#include <cassert>
+#include <cstring>     // for strcmp, memset
+#include <thread>
+#include <atomic>
+#include <exception>   // for exception_ptr
 using namespace std;
 
 
@@ -318,6 +323,143 @@ enum EMxlTag
     k_mxl_tag_words,
 };
 
+//---------------------------------------------------------------------------------------
+// Conversion from element name to EMxlTag. It is done for every element in the file,
+// so names are looked up directly in pugixml buffer, using a perfect hash: the seed
+// is chosen so that all names in k_mxl_tags hash to different slots. If a new tag
+// causes a collision, MxlTagsTable constructor logs an error and names in that slot
+// are searched linearly, until a new seed is found.
+struct MxlTagName
+{
+    const char* name;
+    EMxlTag tag;
+};
+
+static const MxlTagName k_mxl_tags[] = {
+    { "accordion-registration",  k_mxl_tag_accordion_registration },
+    { "articulations",           k_mxl_tag_articulations },
+    { "attributes",              k_mxl_tag_attributes },
+    { "backup",                  k_mxl_tag_backup },
+    { "barline",                 k_mxl_tag_barline },
+    { "bracket",                 k_mxl_tag_bracket },
+    { "clef",                    k_mxl_tag_clef },
+    { "coda",                    k_mxl_tag_coda },
+    { "damp",                    k_mxl_tag_damp },
+    { "damp-all",                k_mxl_tag_damp_all },
+    { "dashes",                  k_mxl_tag_dashes },
+    { "direction",               k_mxl_tag_direction },
+    { "direction-type",          k_mxl_tag_direction_type },
+    { "dynamics",                k_mxl_tag_dynamics },
+    { "ending",                  k_mxl_tag_ending },
+    { "eyeglasses",              k_mxl_tag_eyeglasses },
+    { "fermata",                 k_mxl_tag_fermata },
+    { "forward",                 k_mxl_tag_forward },
+    { "harp-pedals",             k_mxl_tag_harp_pedals },
+    { "image",                   k_mxl_tag_image },
+    { "key",                     k_mxl_tag_key },
+    { "lyric",                   k_mxl_tag_lyric },
+    { "measure",                 k_mxl_tag_measure },
+    { "metronome",               k_mxl_tag_metronome },
+    { "midi-device",             k_mxl_tag_midi_device },
+    { "midi-instrument",         k_mxl_tag_midi_instrument },
+    { "notations",               k_mxl_tag_notations },
+    { "note",                    k_mxl_tag_note },
+    { "octave-shift",            k_mxl_tag_octave_shift },
+    { "ornaments",               k_mxl_tag_ornaments },
+    { "part",                    k_mxl_tag_part },
+    { "part-group",              k_mxl_tag_part_group },
+    { "part-list",               k_mxl_tag_part_list },
+    { "part-name",               k_mxl_tag_part_name },
+    { "pedal",                   k_mxl_tag_pedal },
+    { "percussion",              k_mxl_tag_percussion },
+    { "pitch",                   k_mxl_tag_pitch },
+    { "principal-voice",         k_mxl_tag_principal_voice },
+    { "print",                   k_mxl_tag_print },
+    { "rehearsal",               k_mxl_tag_rehearsal },
+    { "rest",                    k_mxl_tag_rest },
+    { "scordatura",              k_mxl_tag_scordatura },
+    { "score-instrument",        k_mxl_tag_score_instrument },
+    { "score-part",              k_mxl_tag_score_part },
+    { "score-partwise",          k_mxl_tag_score_partwise },
+    { "segno",                   k_mxl_tag_segno },
+    { "slur",                    k_mxl_tag_slur },
+    { "sound",                   k_mxl_tag_sound },
+    { "string-mute",             k_mxl_tag_string_mute },
+    { "technical",               k_mxl_tag_technical },
+    { "text",                    k_mxl_tag_text },
+    { "tied",                    k_mxl_tag_tied },
+    { "time",                    k_mxl_tag_time },
+    { "time-modification",       k_mxl_tag_time_modification },
+    { "tuplet",                  k_mxl_tag_tuplet },
+    { "tuplet-actual",           k_mxl_tag_tuplet_actual },
+    { "tuplet-normal",           k_mxl_tag_tuplet_normal },
+    { "virtual-instrument",      k_mxl_tag_virtual_instr },
+    { "wedge",                   k_mxl_tag_wedge },
+    { "words",                   k_mxl_tag_words },
+};
+
+static const int k_mxl_tags_size = int(sizeof(k_mxl_tags) / sizeof(k_mxl_tags[0]));
+static const uint32_t k_mxl_tags_seed = 723;
+
+//---------------------------------------------------------------------------------------
+class MxlTagsTable
+{
+protected:
+    uint8_t m_slots[256];       //index in k_mxl_tags + 1, 0 if empty slot or k_collision
+    enum { k_collision = 255 };
+
+public:
+    MxlTagsTable()
+    {
+        static_assert(k_mxl_tags_size < k_collision, "Too many tags for MxlTagsTable");
+
+        memset(m_slots, 0, sizeof(m_slots));
+        for (int i=0; i < k_mxl_tags_size; ++i)
+        {
+            uint8_t slot = hash(k_mxl_tags[i].name);
+            if (m_slots[slot] != 0)
+            {
+                LOMSE_LOG_ERROR("Hash collision for MusicXML tag '%s'. "
+                                "Choose a new k_mxl_tags_seed.", k_mxl_tags[i].name);
+                m_slots[slot] = k_collision;
+            }
+            else
+                m_slots[slot] = uint8_t(i + 1);
+        }
+    }
+
+    EMxlTag find(const char* name) const
+    {
+        int i = m_slots[ hash(name) ];
+        if (i == k_collision)
+            return find_linear(name);
+        if (i != 0 && strcmp(k_mxl_tags[i-1].name, name) == 0)
+            return k_mxl_tags[i-1].tag;
+        return k_mxl_tag_undefined;
+    }
+
+protected:
+    static EMxlTag find_linear(const char* name)
+    {
+        for (int i=0; i < k_mxl_tags_size; ++i)
+        {
+            if (strcmp(k_mxl_tags[i].name, name) == 0)
+                return k_mxl_tags[i].tag;
+        }
+        return k_mxl_tag_undefined;
+    }
+
+    //FNV-1a, keeping the 8 most significant bits
+    static uint8_t hash(const char* name)
+    {
+        uint32_t h = k_mxl_tags_seed;
+        for (; *name; ++name)
+            h = (h ^ uint8_t(*name)) * 16777619u;
+        return uint8_t(h >> 24);
+    }
+};
+
+
 
 //=======================================================================================
 // Helper class MxlElementAnalyser.
@@ -5538,12 +5680,45 @@ public:
             remove_score(pImoDoc, pScore);
             return pImoDoc;
         }
-        add_all_instruments(pScore);
 
         // <part>*
-        while (more_children_to_analyse())
+        int numThreads = m_pAnalyser->get_threads_for_parts();
+        if (numThreads > 1)
+        {
+            vector<XmlNode> parts;
+            while (more_children_to_analyse() && get_mandatory("part"))
+                parts.push_back(m_childToAnalyse);
+
+            if (m_pAnalyser->parts_can_be_analysed_concurrently(parts))
+            {
+                //instruments are added to the score after analysing all parts
+                m_pAnalyser->analyse_parts_concurrently(parts, pScore, numThreads);
+            }
+            else
+            {
+                add_all_instruments(pScore);
+                for (size_t i=0; i < parts.size(); ++i)
+                {
+                    m_pAnalyser->analyse_node(&parts[i], pScore);
+                    m_pAnalyser->release_node(&parts[i]);
+                }
+            }
+        }
+        else
         {
-            analyse_mandatory("part", pScore);
+            add_all_instruments(pScore);
+
+            while (more_children_to_analyse())
+            {
+                if (get_mandatory("part"))
+                {
+                    m_pAnalyser->analyse_node(&m_childToAnalyse, pScore);
+
+                    //part content is now in the internal model. Free its xml tree
+                    //before analysing next part
+                    m_pAnalyser->release_node(&m_childToAnalyse);
+                }
+            }
         }
         error_if_more_elements();
 
@@ -6956,6 +7131,7 @@ MxlAnalyser::MxlAnalyser(ostream& reporter, LibraryScope& libraryScope, Document
     , m_pTupletsBuilder(nullptr)
     , m_pSlursBuilder(nullptr)
     , m_pVoltasBuilder(nullptr)
+    , m_fPartWorker(false)
     , m_musicxmlVersion(0)
     , m_pNodeImo(nullptr)
     , m_tieNum(0)
@@ -6977,74 +7153,12 @@ MxlAnalyser::MxlAnalyser(ostream& reporter, LibraryScope& libraryScope, Document
     , m_measuresCounter(0)
     , m_curVoice(0)
 {
-    //populate the name to enum conversion map
-    m_NameToEnum["accordion-registration"] = k_mxl_tag_accordion_registration;
-    m_NameToEnum["articulations"] = k_mxl_tag_articulations;
-    m_NameToEnum["attributes"] = k_mxl_tag_attributes;
-    m_NameToEnum["backup"] = k_mxl_tag_backup;
-    m_NameToEnum["barline"] = k_mxl_tag_barline;
-    m_NameToEnum["bracket"] = k_mxl_tag_bracket;
-    m_NameToEnum["clef"] = k_mxl_tag_clef;
-    m_NameToEnum["coda"] = k_mxl_tag_coda;
-    m_NameToEnum["damp"] = k_mxl_tag_damp;
-    m_NameToEnum["damp-all"] = k_mxl_tag_damp_all;
-    m_NameToEnum["dashes"] = k_mxl_tag_dashes;
-    m_NameToEnum["direction"] = k_mxl_tag_direction;
-    m_NameToEnum["direction-type"] = k_mxl_tag_direction_type;
-    m_NameToEnum["dynamics"] = k_mxl_tag_dynamics;
-    m_NameToEnum["ending"] = k_mxl_tag_ending;
-    m_NameToEnum["eyeglasses"] = k_mxl_tag_eyeglasses;
-    m_NameToEnum["fermata"] = k_mxl_tag_fermata;
-    m_NameToEnum["forward"] = k_mxl_tag_forward;
-    m_NameToEnum["harp-pedals"] = k_mxl_tag_harp_pedals;
-    m_NameToEnum["image"] = k_mxl_tag_image;
-    m_NameToEnum["key"] = k_mxl_tag_key;
-    m_NameToEnum["lyric"] = k_mxl_tag_lyric;
-    m_NameToEnum["measure"] = k_mxl_tag_measure;
-    m_NameToEnum["metronome"] = k_mxl_tag_metronome;
-    m_NameToEnum["midi-device"] = k_mxl_tag_midi_device;
-    m_NameToEnum["midi-instrument"] = k_mxl_tag_midi_instrument;
-    m_NameToEnum["notations"] = k_mxl_tag_notations;
-    m_NameToEnum["note"] = k_mxl_tag_note;
-    m_NameToEnum["octave-shift"] = k_mxl_tag_octave_shift;
-    m_NameToEnum["ornaments"] = k_mxl_tag_ornaments;
-    m_NameToEnum["part"] = k_mxl_tag_part;
-    m_NameToEnum["part-group"] = k_mxl_tag_part_group;
-    m_NameToEnum["part-list"] = k_mxl_tag_part_list;
-    m_NameToEnum["part-name"] = k_mxl_tag_part_name;
-    m_NameToEnum["pedal"] = k_mxl_tag_pedal;
-    m_NameToEnum["percussion"] = k_mxl_tag_percussion;
-    m_NameToEnum["pitch"] = k_mxl_tag_pitch;
-    m_NameToEnum["principal-voice"] = k_mxl_tag_principal_voice;
-    m_NameToEnum["print"] = k_mxl_tag_print;
-    m_NameToEnum["rehearsal"] = k_mxl_tag_rehearsal;
-    m_NameToEnum["rest"] = k_mxl_tag_rest;
-    m_NameToEnum["scordatura"] = k_mxl_tag_scordatura;
-    m_NameToEnum["score-instrument"] = k_mxl_tag_score_instrument;
-    m_NameToEnum["score-part"] = k_mxl_tag_score_part;
-    m_NameToEnum["score-partwise"] = k_mxl_tag_score_partwise;
-    m_NameToEnum["segno"] = k_mxl_tag_segno;
-    m_NameToEnum["slur"] = k_mxl_tag_slur;
-    m_NameToEnum["sound"] = k_mxl_tag_sound;
-    m_NameToEnum["string-mute"] = k_mxl_tag_string_mute;
-    m_NameToEnum["technical"] = k_mxl_tag_technical;
-    m_NameToEnum["text"] = k_mxl_tag_text;
-    m_NameToEnum["tied"] = k_mxl_tag_tied;
-    m_NameToEnum["time"] = k_mxl_tag_time;
-    m_NameToEnum["time-modification"] = k_mxl_tag_time_modification;
-    m_NameToEnum["tuplet"] = k_mxl_tag_tuplet;
-    m_NameToEnum["tuplet-actual"] = k_mxl_tag_tuplet_actual;
-    m_NameToEnum["tuplet-normal"] = k_mxl_tag_tuplet_normal;
-    m_NameToEnum["virtual-instrument"] = k_mxl_tag_virtual_instr;
-    m_NameToEnum["wedge"] = k_mxl_tag_wedge;
-    m_NameToEnum["words"] = k_mxl_tag_words;
 }
 
 //---------------------------------------------------------------------------------------
 MxlAnalyser::~MxlAnalyser()
 {
     delete_relation_builders();
-    m_NameToEnum.clear();
     m_lyrics.clear();
     m_lyricIndex.clear();
 }
@@ -7060,7 +7174,7 @@ void MxlAnalyser::delete_relation_builders()
 }
 
 //---------------------------------------------------------------------------------------
-ImoObj* MxlAnalyser::analyse_tree_and_get_object(XmlNode* root)
+void MxlAnalyser::create_relation_builders()
 {
     delete_relation_builders();
     m_pTiesBuilder = LOMSE_NEW MxlTiesBuilder(m_reporter, this);
@@ -7068,6 +7182,12 @@ ImoObj* MxlAnalyser::analyse_tree_and_get_object(XmlNode* root)
     m_pTupletsBuilder = LOMSE_NEW MxlTupletsBuilder(m_reporter, this);
     m_pSlursBuilder = LOMSE_NEW MxlSlursBuilder(m_reporter, this);
     m_pVoltasBuilder = LOMSE_NEW MxlVoltasBuilder(m_reporter, this);
+}
+
+//---------------------------------------------------------------------------------------
+ImoObj* MxlAnalyser::analyse_tree_and_get_object(XmlNode* root)
+{
+    create_relation_builders();
 
     m_pTree = root;
 //    m_curStaff = 0;
@@ -7083,19 +7203,15 @@ ImoObj* MxlAnalyser::analyse_tree(XmlNode* tree, const string& locator)
 }
 
 //---------------------------------------------------------------------------------------
-ImoObj* MxlAnalyser::analyse_node(XmlNode* pNode, ImoObj* pAnchor)
+int MxlAnalyser::get_line_number(XmlNode* node)
 {
-    //m_reporter << "DBG. Analysing node: " << pNode->name() << endl;
-    MxlElementAnalyser* a = new_analyser( pNode->name(), pAnchor );
-    ImoObj* pImo = a->analyse_node(pNode);
-    delete a;
-    return pImo;
+    return m_pParser->get_line_number(node);
 }
 
 //---------------------------------------------------------------------------------------
-int MxlAnalyser::get_line_number(XmlNode* node)
+void MxlAnalyser::release_node(XmlNode* node)
 {
-    return m_pParser->get_line_number(node);
+    m_pParser->release_node(node);
 }
 
 //---------------------------------------------------------------------------------------
@@ -7108,6 +7224,245 @@ void MxlAnalyser::prepare_for_new_instrument_content()
     m_measuresCounter = 0;
 }
 
+//---------------------------------------------------------------------------------------
+int MxlAnalyser::get_threads_for_parts()
+{
+    int numThreads = m_libraryScope.get_musicxml_options()->analysis_threads();
+    if (numThreads <= 0)
+        numThreads = max(1, int(std::thread::hardware_concurrency()));
+    return numThreads;
+}
+
+//---------------------------------------------------------------------------------------
+bool MxlAnalyser::parts_can_be_analysed_concurrently(vector<XmlNode>& parts)
+{
+    //When analysing parts in sequence, a part starts with the divisions and voice
+    //of the previous one. Part workers start with the initial values, so each part,
+    //except the first one, must set them before using them
+    for (size_t i=1; i < parts.size(); ++i)
+    {
+        if (part_depends_on_previous_part(parts[i]))
+            return false;
+    }
+    return true;
+}
+
+//---------------------------------------------------------------------------------------
+bool MxlAnalyser::part_depends_on_previous_part(XmlNode& part)
+{
+    //divisions: must be defined in first measure, before any element with duration
+    //or offset. Some elements not using divisions are checked, just to keep it simple
+    bool fDivisions = false;
+    XmlNode measure = part.child("measure");
+    XmlNode child = measure.first_child();
+    for (; !child.is_null(); child = child.next_sibling())
+    {
+        string name = child.name();
+        if (name == "attributes" && !child.child("divisions").is_null())
+        {
+            fDivisions = true;
+            break;
+        }
+        if (name == "note" || name == "backup" || name == "forward"
+            || name == "direction" || name == "harmony" || name == "figured-bass")
+        {
+            break;
+        }
+    }
+    if (!fDivisions)
+        return true;
+
+    //voice: first note must have a <voice> element
+    for (; !measure.is_null(); measure = measure.next_sibling())
+    {
+        XmlNode note = measure.child("note");
+        if (!note.is_null())
+            return note.child("voice").is_null();
+    }
+    return false;
+}
+
+//---------------------------------------------------------------------------------------
+void MxlAnalyser::analyse_parts_concurrently(vector<XmlNode>& parts, ImoScore* pScore,
+                                             int numThreads)
+{
+    //Each <part> is analysed by its own MxlAnalyser, taking parts from a common queue.
+    //Instruments are not yet in the score, so the parent objects shared by all parts
+    //are not modified. State shared by all parts (part list, sound indexes, error
+    //messages and ids) is merged when all threads finish, in <part> order, so that
+    //the result does not depend on threads timing.
+
+    size_t numParts = parts.size();
+    vector<MxlAnalyser*> workers;
+    vector<stringstream*> reports;
+    for (size_t i=0; i < numParts; ++i)
+    {
+        stringstream* pReport = LOMSE_NEW stringstream();
+        reports.push_back(pReport);
+        workers.push_back( new_part_worker(*pReport, pScore) );
+
+        //next parts must see this one as added, for detecting duplicated parts
+        string id = parts[i].attribute_value("id");
+        if (!id.empty() && get_instrument(id))
+            m_partList.mark_part_as_added(id);
+    }
+
+    vector< vector<ImoId> > idsLogs(numParts);
+    vector<std::exception_ptr> errors(numParts);
+    std::atomic<size_t> nextPart(0);
+    auto analyse_parts = [&]()
+    {
+        size_t i;
+        while ((i = nextPart++) < numParts)
+        {
+            m_pDoc->log_ids_assigned_by_this_thread(&idsLogs[i]);
+            try
+            {
+                workers[i]->analyse_node(&parts[i], pScore);
+            }
+            catch (...)
+            {
+                errors[i] = std::current_exception();
+            }
+            m_pDoc->log_ids_assigned_by_this_thread(nullptr);
+        }
+    };
+
+    m_pDoc->begin_concurrent_building();
+    vector<std::thread> threads;
+    numThreads = min(numThreads, int(numParts));
+    for (int i=1; i < numThreads; ++i)
+        threads.push_back( std::thread(analyse_parts) );
+    analyse_parts();
+    for (size_t i=0; i < threads.size(); ++i)
+        threads[i].join();
+    m_pDoc->end_concurrent_building(idsLogs);
+
+    add_all_instruments(pScore);
+    for (size_t i=0; i < numParts; ++i)
+    {
+        m_reporter << reports[i]->str();
+        merge_part_worker(workers[i], get_instrument(parts[i].attribute_value("id")));
+        delete workers[i];
+        delete reports[i];
+
+        //part content is now in the internal model. Free its xml tree
+        release_node(&parts[i]);
+    }
+
+    for (size_t i=0; i < numParts; ++i)
+    {
+        if (errors[i])
+            std::rethrow_exception(errors[i]);
+    }
+}
+
+//---------------------------------------------------------------------------------------
+MxlAnalyser* MxlAnalyser::new_part_worker(ostream& reporter, ImoScore* pScore)
+{
+    MxlAnalyser* pWorker = LOMSE_NEW MxlAnalyser(reporter, m_libraryScope, m_pDoc,
+                                                 m_pParser);
+    pWorker->create_relation_builders();
+    pWorker->m_fPartWorker = true;
+    pWorker->m_fileLocator = m_fileLocator;
+    pWorker->m_musicxmlVersion = m_musicxmlVersion;
+    pWorker->m_pCurScore = pScore;
+    pWorker->m_pImoDoc = m_pImoDoc;
+    pWorker->m_partList = m_partList;
+    pWorker->m_partList.do_not_delete_instruments_in_destructor();
+    pWorker->m_soundIdToIdx = m_soundIdToIdx;
+    pWorker->m_latestMidiInfo = m_latestMidiInfo;
+    pWorker->m_divisions = m_divisions;
+    pWorker->m_curVoice = m_curVoice;
+    return pWorker;
+}
+
+//---------------------------------------------------------------------------------------
+void MxlAnalyser::merge_part_worker(MxlAnalyser* pWorker, ImoInstrument* pInstr)
+{
+    //each worker numbers ties and slurs from 1. Renumber them as if all parts were
+    //analysed in sequence, continuing the numbers used by previous parts
+    if (pInstr)
+        shift_relation_numbers(pInstr, m_tieNum, m_slurNum);
+    m_tieNum += pWorker->m_tieNum;
+    m_slurNum += pWorker->m_slurNum;
+    m_voltaNum += pWorker->m_voltaNum;
+
+    map<string, int>::const_iterator it;
+    for (it = pWorker->m_soundIdToIdx.begin(); it != pWorker->m_soundIdToIdx.end(); ++it)
+    {
+        ImoMidiInfo* pMidi = pWorker->m_latestMidiInfo[it->second];
+        int idx = get_index_for_sound(it->first);
+        if (idx == -1 || m_latestMidiInfo[idx] != pMidi)
+            set_latest_midi_info_for(it->first, pMidi);
+    }
+
+    vector< pair<ImoInstrument*, LUnits> >::const_iterator itL;
+    for (itL = pWorker->m_lyricsSpaceAfter.begin(); itL != pWorker->m_lyricsSpaceAfter.end(); ++itL)
+        add_marging_space_after(itL->first, itL->second);
+}
+
+//---------------------------------------------------------------------------------------
+void MxlAnalyser::shift_relation_numbers(ImoInstrument* pInstr, int tieShift,
+                                         int slurShift)
+{
+    if (tieShift == 0 && slurShift == 0)
+        return;
+
+    ImoMusicData* pMD = pInstr->get_musicdata();
+    ImoObj::children_iterator it;
+    for (it = pMD->begin(); it != pMD->end(); ++it)
+    {
+        if (!(*it)->is_staffobj())
+            continue;
+
+        ImoStaffObj* pSO = static_cast<ImoStaffObj*>(*it);
+        ImoRelations* pRelObjs = pSO->get_relations();
+        if (!pRelObjs)
+            continue;
+
+        list<ImoRelObj*>& relations = pRelObjs->get_relations();
+        list<ImoRelObj*>::iterator itR;
+        for (itR = relations.begin(); itR != relations.end(); ++itR)
+        {
+            //each relation is renumbered once, when found in its start object
+            ImoRelObj* pRO = *itR;
+            if (pRO->get_start_object() != pSO)
+                continue;
+
+            if (pRO->is_tie())
+            {
+                ImoTie* pTie = static_cast<ImoTie*>(pRO);
+                pTie->set_tie_number(pTie->get_tie_number() + tieShift);
+            }
+            else if (pRO->is_slur())
+            {
+                ImoSlur* pSlur = static_cast<ImoSlur*>(pRO);
+                pSlur->set_slur_number(pSlur->get_slur_number() + slurShift);
+            }
+            else
+                continue;
+
+            std::list< pair<ImoStaffObj*, ImoRelDataObj*> >& objs = pRO->get_related_objects();
+            std::list< pair<ImoStaffObj*, ImoRelDataObj*> >::iterator itD;
+            for (itD = objs.begin(); itD != objs.end(); ++itD)
+            {
+                ImoRelDataObj* pData = itD->second;
+                if (pData && pData->is_tie_data())
+                {
+                    ImoTieData* pTD = static_cast<ImoTieData*>(pData);
+                    pTD->set_tie_number(pTD->get_tie_number() + tieShift);
+                }
+                else if (pData && pData->is_slur_data())
+                {
+                    ImoSlurData* pSD = static_cast<ImoSlurData*>(pData);
+                    pSD->set_slur_number(pSD->get_slur_number() + slurShift);
+                }
+            }
+        }
+    }
+}
+
 //---------------------------------------------------------------------------------------
 int MxlAnalyser::get_index_for_sound(const string& id)
 {
@@ -7234,18 +7589,13 @@ void MxlAnalyser::add_marging_space_for_lyrics(ImoNote* pNote, ImoLyric* pLyric)
         int staves = pInstr->get_num_staves();
         if (++iStaff == staves)
         {
-            //add space to top margin of first staff in next instrument
-            //AWARE: All instruments are already created
-            int iInstr = m_pCurScore->get_instr_number_for(pInstr) + 1;
-            if (iInstr < m_pCurScore->get_num_instruments())
-            {
-                pInstr = m_pCurScore->get_instrument(iInstr);
-                pInstr->reserve_space_for_lyrics(0, space);
-            }
+            //add space to top margin of first staff in next instrument. When parts
+            //are analysed concurrently, next instrument belongs to other thread and
+            //instruments are not yet in the score. Defer it.
+            if (m_fPartWorker)
+                m_lyricsSpaceAfter.push_back( make_pair(pInstr, space) );
             else
-            {
-                ;   //TODO: Space for last staff in last instrument
-            }
+                add_marging_space_after(pInstr, space);
         }
         else
         {
@@ -7255,6 +7605,23 @@ void MxlAnalyser::add_marging_space_for_lyrics(ImoNote* pNote, ImoLyric* pLyric)
     }
 }
 
+//---------------------------------------------------------------------------------------
+void MxlAnalyser::add_marging_space_after(ImoInstrument* pInstr, LUnits space)
+{
+    //add space to top margin of first staff in instrument following pInstr
+    //AWARE: All instruments are already created
+    int iInstr = m_pCurScore->get_instr_number_for(pInstr) + 1;
+    if (iInstr < m_pCurScore->get_num_instruments())
+    {
+        pInstr = m_pCurScore->get_instrument(iInstr);
+        pInstr->reserve_space_for_lyrics(0, space);
+    }
+    else
+    {
+        ;   //TODO: Space for last staff in last instrument
+    }
+}
+
 //---------------------------------------------------------------------------------------
 ImoInstrGroup* MxlAnalyser::start_part_group(int number)
 {
@@ -7407,84 +7774,94 @@ bool MxlAnalyser::to_integer(const string& text, int* pResult)
 }
 
 //---------------------------------------------------------------------------------------
-MxlElementAnalyser* MxlAnalyser::new_analyser(const string& name, ImoObj* pAnchor)
-{
-    //Factory method to create analysers
-
-    switch ( name_to_enum(name) )
-    {
-//        case k_mxl_tag_accordion_registration: return LOMSE_NEW AccordionRegistrationMxlAnalyser(this, m_reporter, m_libraryScope, pAnchor);
-        case k_mxl_tag_articulations:        return LOMSE_NEW ArticulationsMxlAnalyser(this, m_reporter, m_libraryScope, pAnchor);
-        case k_mxl_tag_attributes:           return LOMSE_NEW AtribbutesMxlAnalyser(this, m_reporter, m_libraryScope, pAnchor);
-        case k_mxl_tag_backup:               return LOMSE_NEW FwdBackMxlAnalyser(this, m_reporter, m_libraryScope, pAnchor);
-        case k_mxl_tag_barline:              return LOMSE_NEW BarlineMxlAnalyser(this, m_reporter, m_libraryScope, pAnchor);
-//        case k_mxl_tag_bracket:              return LOMSE_NEW BracketMxlAnalyser(this, m_reporter, m_libraryScope, pAnchor);
-        case k_mxl_tag_clef:                 return LOMSE_NEW ClefMxlAnalyser(this, m_reporter, m_libraryScope, pAnchor);
-        case k_mxl_tag_coda:                 return LOMSE_NEW CodaMxlAnalyser(this, m_reporter, m_libraryScope, pAnchor);
-//        case k_mxl_tag_damp:                 return LOMSE_NEW DampMxlAnalyser(this, m_reporter, m_libraryScope, pAnchor);
-//        case k_mxl_tag_damp_all:             return LOMSE_NEW DampAllMxlAnalyser(this, m_reporter, m_libraryScope, pAnchor);
-//        case k_mxl_tag_dashes:               return LOMSE_NEW DashesMxlAnalyser(this, m_reporter, m_libraryScope, pAnchor);
-        case k_mxl_tag_direction:            return LOMSE_NEW DirectionMxlAnalyser(this, m_reporter, m_libraryScope, pAnchor);
-        case k_mxl_tag_direction_type:       return LOMSE_NEW DirectionTypeMxlAnalyser(this, m_reporter, m_libraryScope, pAnchor);
-        case k_mxl_tag_dynamics:             return LOMSE_NEW DynamicsMxlAnalyser(this, m_reporter, m_libraryScope, pAnchor);
-        case k_mxl_tag_ending:               return LOMSE_NEW EndingMxlAnalyser(this, m_reporter, m_libraryScope, pAnchor);
-//        case k_mxl_tag_eyeglasses:           return LOMSE_NEW EyeglassesMxlAnalyser(this, m_reporter, m_libraryScope, pAnchor);
-        case k_mxl_tag_fermata:              return LOMSE_NEW FermataMxlAnalyser(this, m_reporter, m_libraryScope, pAnchor);
-        case k_mxl_tag_forward:              return LOMSE_NEW FwdBackMxlAnalyser(this, m_reporter, m_libraryScope, pAnchor);
-//        case k_mxl_tag_harp_pedals:          return LOMSE_NEW HarpPedalsMxlAnalyser(this, m_reporter, m_libraryScope, pAnchor);
-//        case k_mxl_tag_image:                return LOMSE_NEW ImageMxlAnalyser(this, m_reporter, m_libraryScope, pAnchor);
-        case k_mxl_tag_key:                  return LOMSE_NEW KeyMxlAnalyser(this, m_reporter, m_libraryScope, pAnchor);
-        case k_mxl_tag_lyric:                return LOMSE_NEW LyricMxlAnalyser(this, m_reporter, m_libraryScope, pAnchor);
-        case k_mxl_tag_measure:              return LOMSE_NEW MeasureMxlAnalyser(this, m_reporter, m_libraryScope, pAnchor);
-        case k_mxl_tag_metronome:            return LOMSE_NEW MetronomeMxlAnalyser(this, m_reporter, m_libraryScope, pAnchor);
-        case k_mxl_tag_midi_device:          return LOMSE_NEW MidiDeviceMxlAnalyser(this, m_reporter, m_libraryScope, pAnchor);
-        case k_mxl_tag_midi_instrument:      return LOMSE_NEW MidiInstrumentMxlAnalyser(this, m_reporter, m_libraryScope, pAnchor);
-        case k_mxl_tag_notations:            return LOMSE_NEW NotationsMxlAnalyser(this, m_reporter, m_libraryScope, pAnchor);
-        case k_mxl_tag_note:                 return LOMSE_NEW NoteRestMxlAnalyser(this, m_reporter, m_libraryScope, pAnchor);
-//        case k_mxl_tag_octave_shift:         return LOMSE_NEW OctaveShiftMxlAnalyser(this, m_reporter, m_libraryScope, pAnchor);
-        case k_mxl_tag_ornaments:            return LOMSE_NEW OrnamentsMxlAnalyser(this, m_reporter, m_libraryScope, pAnchor);
-        case k_mxl_tag_part:                 return LOMSE_NEW PartMxlAnalyser(this, m_reporter, m_libraryScope, pAnchor);
-        case k_mxl_tag_part_group:           return LOMSE_NEW PartGroupMxlAnalyser(this, m_reporter, m_libraryScope, pAnchor);
-        case k_mxl_tag_part_list:            return LOMSE_NEW PartListMxlAnalyser(this, m_reporter, m_libraryScope);
-        case k_mxl_tag_part_name:            return LOMSE_NEW PartNameMxlAnalyser(this, m_reporter, m_libraryScope, pAnchor);
-//        case k_mxl_tag_pedal:                return LOMSE_NEW PedalMxlAnalyser(this, m_reporter, m_libraryScope, pAnchor);
-//        case k_mxl_tag_percussion:           return LOMSE_NEW PercussionMxlAnalyser(this, m_reporter, m_libraryScope, pAnchor);
-        case k_mxl_tag_pitch:                return LOMSE_NEW PitchMxlAnalyser(this, m_reporter, m_libraryScope, pAnchor);
-//        case k_mxl_tag_principal_voice:      return LOMSE_NEW PrincipalVoiceMxlAnalyser(this, m_reporter, m_libraryScope, pAnchor);
-        case k_mxl_tag_print:                return LOMSE_NEW PrintMxlAnalyser(this, m_reporter, m_libraryScope, pAnchor);
-//        case k_mxl_tag_rehearsal:            return LOMSE_NEW RehearsalMxlAnalyser(this, m_reporter, m_libraryScope, pAnchor);
-//        case k_mxl_tag_scordatura:           return LOMSE_NEW ScordaturaMxlAnalyser(this, m_reporter, m_libraryScope, pAnchor);
-        case k_mxl_tag_score_instrument:     return LOMSE_NEW ScoreInstrumentMxlAnalyser(this, m_reporter, m_libraryScope, pAnchor);
-        case k_mxl_tag_score_part:           return LOMSE_NEW ScorePartMxlAnalyser(this, m_reporter, m_libraryScope);
-        case k_mxl_tag_score_partwise:       return LOMSE_NEW ScorePartwiseMxlAnalyser(this, m_reporter, m_libraryScope);
-        case k_mxl_tag_segno:                return LOMSE_NEW SegnoMxlAnalyser(this, m_reporter, m_libraryScope, pAnchor);
-        case k_mxl_tag_slur:                 return LOMSE_NEW SlurMxlAnalyser(this, m_reporter, m_libraryScope, pAnchor);
-        case k_mxl_tag_sound:                return LOMSE_NEW SoundMxlAnalyser(this, m_reporter, m_libraryScope, pAnchor);
-//        case k_mxl_tag_string_mute:          return LOMSE_NEW StringMmuteMxlAnalyser(this, m_reporter, m_libraryScope, pAnchor);
-        case k_mxl_tag_technical:            return LOMSE_NEW TecnicalMxlAnalyser(this, m_reporter, m_libraryScope, pAnchor);
-        case k_mxl_tag_text:                 return LOMSE_NEW TextMxlAnalyser(this, m_reporter, m_libraryScope, pAnchor);
-        case k_mxl_tag_tied:                 return LOMSE_NEW TiedMxlAnalyser(this, m_reporter, m_libraryScope, pAnchor);
-        case k_mxl_tag_time:                 return LOMSE_NEW TimeMxlAnalyser(this, m_reporter, m_libraryScope, pAnchor);
-        case k_mxl_tag_time_modification:    return LOMSE_NEW TimeModificationXmlAnalyser(this, m_reporter, m_libraryScope, pAnchor);
-        case k_mxl_tag_tuplet:               return LOMSE_NEW TupletMxlAnalyser(this, m_reporter, m_libraryScope, pAnchor);
-        case k_mxl_tag_tuplet_actual:        return LOMSE_NEW TupletNumbersMxlAnalyser(this, m_reporter, m_libraryScope, pAnchor);
-        case k_mxl_tag_tuplet_normal:        return LOMSE_NEW TupletNumbersMxlAnalyser(this, m_reporter, m_libraryScope, pAnchor);
-        case k_mxl_tag_virtual_instr:        return LOMSE_NEW VirtualInstrumentMxlAnalyser(this, m_reporter, m_libraryScope, pAnchor);
-//        case k_mxl_tag_wedge:                return LOMSE_NEW WedgeMxlAnalyser(this, m_reporter, m_libraryScope, pAnchor);
-        case k_mxl_tag_words:                return LOMSE_NEW WordsMxlAnalyser(this, m_reporter, m_libraryScope, pAnchor);
+// Creates an element analyser of type T on the stack and uses it to analyse pNode
+template <class T, class... Args>
+static inline ImoObj* analyse_with(XmlNode* pNode, Args&&... args)
+{
+    T a(std::forward<Args>(args)...);
+    return a.analyse_node(pNode);
+}
+
+//---------------------------------------------------------------------------------------
+ImoObj* MxlAnalyser::analyse_node(XmlNode* pNode, ImoObj* pAnchor)
+{
+    //m_reporter << "DBG. Analysing node: " << pNode->name() << endl;
+
+    //Element analysers only live while analysing the node, so they are created
+    //on the stack instead of in the heap
+
+    switch ( name_to_enum(pNode->c_name()) )
+    {
+//        case k_mxl_tag_accordion_registration: return analyse_with<AccordionRegistrationMxlAnalyser>(pNode, this, m_reporter, m_libraryScope, pAnchor);
+        case k_mxl_tag_articulations:          return analyse_with<ArticulationsMxlAnalyser>(pNode, this, m_reporter, m_libraryScope, pAnchor);
+        case k_mxl_tag_attributes:             return analyse_with<AtribbutesMxlAnalyser>(pNode, this, m_reporter, m_libraryScope, pAnchor);
+        case k_mxl_tag_backup:                 return analyse_with<FwdBackMxlAnalyser>(pNode, this, m_reporter, m_libraryScope, pAnchor);
+        case k_mxl_tag_barline:                return analyse_with<BarlineMxlAnalyser>(pNode, this, m_reporter, m_libraryScope, pAnchor);
+//        case k_mxl_tag_bracket:                return analyse_with<BracketMxlAnalyser>(pNode, this, m_reporter, m_libraryScope, pAnchor);
+        case k_mxl_tag_clef:                   return analyse_with<ClefMxlAnalyser>(pNode, this, m_reporter, m_libraryScope, pAnchor);
+        case k_mxl_tag_coda:                   return analyse_with<CodaMxlAnalyser>(pNode, this, m_reporter, m_libraryScope, pAnchor);
+//        case k_mxl_tag_damp:                   return analyse_with<DampMxlAnalyser>(pNode, this, m_reporter, m_libraryScope, pAnchor);
+//        case k_mxl_tag_damp_all:               return analyse_with<DampAllMxlAnalyser>(pNode, this, m_reporter, m_libraryScope, pAnchor);
+//        case k_mxl_tag_dashes:                 return analyse_with<DashesMxlAnalyser>(pNode, this, m_reporter, m_libraryScope, pAnchor);
+        case k_mxl_tag_direction:              return analyse_with<DirectionMxlAnalyser>(pNode, this, m_reporter, m_libraryScope, pAnchor);
+        case k_mxl_tag_direction_type:         return analyse_with<DirectionTypeMxlAnalyser>(pNode, this, m_reporter, m_libraryScope, pAnchor);
+        case k_mxl_tag_dynamics:               return analyse_with<DynamicsMxlAnalyser>(pNode, this, m_reporter, m_libraryScope, pAnchor);
+        case k_mxl_tag_ending:                 return analyse_with<EndingMxlAnalyser>(pNode, this, m_reporter, m_libraryScope, pAnchor);
+//        case k_mxl_tag_eyeglasses:             return analyse_with<EyeglassesMxlAnalyser>(pNode, this, m_reporter, m_libraryScope, pAnchor);
+        case k_mxl_tag_fermata:                return analyse_with<FermataMxlAnalyser>(pNode, this, m_reporter, m_libraryScope, pAnchor);
+        case k_mxl_tag_forward:                return analyse_with<FwdBackMxlAnalyser>(pNode, this, m_reporter, m_libraryScope, pAnchor);
+//        case k_mxl_tag_harp_pedals:            return analyse_with<HarpPedalsMxlAnalyser>(pNode, this, m_reporter, m_libraryScope, pAnchor);
+//        case k_mxl_tag_image:                  return analyse_with<ImageMxlAnalyser>(pNode, this, m_reporter, m_libraryScope, pAnchor);
+        case k_mxl_tag_key:                    return analyse_with<KeyMxlAnalyser>(pNode, this, m_reporter, m_libraryScope, pAnchor);
+        case k_mxl_tag_lyric:                  return analyse_with<LyricMxlAnalyser>(pNode, this, m_reporter, m_libraryScope, pAnchor);
+        case k_mxl_tag_measure:                return analyse_with<MeasureMxlAnalyser>(pNode, this, m_reporter, m_libraryScope, pAnchor);
+        case k_mxl_tag_metronome:              return analyse_with<MetronomeMxlAnalyser>(pNode, this, m_reporter, m_libraryScope, pAnchor);
+        case k_mxl_tag_midi_device:            return analyse_with<MidiDeviceMxlAnalyser>(pNode, this, m_reporter, m_libraryScope, pAnchor);
+        case k_mxl_tag_midi_instrument:        return analyse_with<MidiInstrumentMxlAnalyser>(pNode, this, m_reporter, m_libraryScope, pAnchor);
+        case k_mxl_tag_notations:              return analyse_with<NotationsMxlAnalyser>(pNode, this, m_reporter, m_libraryScope, pAnchor);
+        case k_mxl_tag_note:                   return analyse_with<NoteRestMxlAnalyser>(pNode, this, m_reporter, m_libraryScope, pAnchor);
+//        case k_mxl_tag_octave_shift:           return analyse_with<OctaveShiftMxlAnalyser>(pNode, this, m_reporter, m_libraryScope, pAnchor);
+        case k_mxl_tag_ornaments:              return analyse_with<OrnamentsMxlAnalyser>(pNode, this, m_reporter, m_libraryScope, pAnchor);
+        case k_mxl_tag_part:                   return analyse_with<PartMxlAnalyser>(pNode, this, m_reporter, m_libraryScope, pAnchor);
+        case k_mxl_tag_part_group:             return analyse_with<PartGroupMxlAnalyser>(pNode, this, m_reporter, m_libraryScope, pAnchor);
+        case k_mxl_tag_part_list:              return analyse_with<PartListMxlAnalyser>(pNode, this, m_reporter, m_libraryScope);
+        case k_mxl_tag_part_name:              return analyse_with<PartNameMxlAnalyser>(pNode, this, m_reporter, m_libraryScope, pAnchor);
+//        case k_mxl_tag_pedal:                  return analyse_with<PedalMxlAnalyser>(pNode, this, m_reporter, m_libraryScope, pAnchor);
+//        case k_mxl_tag_percussion:             return analyse_with<PercussionMxlAnalyser>(pNode, this, m_reporter, m_libraryScope, pAnchor);
+        case k_mxl_tag_pitch:                  return analyse_with<PitchMxlAnalyser>(pNode, this, m_reporter, m_libraryScope, pAnchor);
+//        case k_mxl_tag_principal_voice:        return analyse_with<PrincipalVoiceMxlAnalyser>(pNode, this, m_reporter, m_libraryScope, pAnchor);
+        case k_mxl_tag_print:                  return analyse_with<PrintMxlAnalyser>(pNode, this, m_reporter, m_libraryScope, pAnchor);
+//        case k_mxl_tag_rehearsal:              return analyse_with<RehearsalMxlAnalyser>(pNode, this, m_reporter, m_libraryScope, pAnchor);
+//        case k_mxl_tag_scordatura:             return analyse_with<ScordaturaMxlAnalyser>(pNode, this, m_reporter, m_libraryScope, pAnchor);
+        case k_mxl_tag_score_instrument:       return analyse_with<ScoreInstrumentMxlAnalyser>(pNode, this, m_reporter, m_libraryScope, pAnchor);
+        case k_mxl_tag_score_part:             return analyse_with<ScorePartMxlAnalyser>(pNode, this, m_reporter, m_libraryScope);
+        case k_mxl_tag_score_partwise:         return analyse_with<ScorePartwiseMxlAnalyser>(pNode, this, m_reporter, m_libraryScope);
+        case k_mxl_tag_segno:                  return analyse_with<SegnoMxlAnalyser>(pNode, this, m_reporter, m_libraryScope, pAnchor);
+        case k_mxl_tag_slur:                   return analyse_with<SlurMxlAnalyser>(pNode, this, m_reporter, m_libraryScope, pAnchor);
+        case k_mxl_tag_sound:                  return analyse_with<SoundMxlAnalyser>(pNode, this, m_reporter, m_libraryScope, pAnchor);
+//        case k_mxl_tag_string_mute:            return analyse_with<StringMmuteMxlAnalyser>(pNode, this, m_reporter, m_libraryScope, pAnchor);
+        case k_mxl_tag_technical:              return analyse_with<TecnicalMxlAnalyser>(pNode, this, m_reporter, m_libraryScope, pAnchor);
+        case k_mxl_tag_text:                   return analyse_with<TextMxlAnalyser>(pNode, this, m_reporter, m_libraryScope, pAnchor);
+        case k_mxl_tag_tied:                   return analyse_with<TiedMxlAnalyser>(pNode, this, m_reporter, m_libraryScope, pAnchor);
+        case k_mxl_tag_time:                   return analyse_with<TimeMxlAnalyser>(pNode, this, m_reporter, m_libraryScope, pAnchor);
+        case k_mxl_tag_time_modification:      return analyse_with<TimeModificationXmlAnalyser>(pNode, this, m_reporter, m_libraryScope, pAnchor);
+        case k_mxl_tag_tuplet:                 return analyse_with<TupletMxlAnalyser>(pNode, this, m_reporter, m_libraryScope, pAnchor);
+        case k_mxl_tag_tuplet_actual:          return analyse_with<TupletNumbersMxlAnalyser>(pNode, this, m_reporter, m_libraryScope, pAnchor);
+        case k_mxl_tag_tuplet_normal:          return analyse_with<TupletNumbersMxlAnalyser>(pNode, this, m_reporter, m_libraryScope, pAnchor);
+        case k_mxl_tag_virtual_instr:          return analyse_with<VirtualInstrumentMxlAnalyser>(pNode, this, m_reporter, m_libraryScope, pAnchor);
+//        case k_mxl_tag_wedge:                  return analyse_with<WedgeMxlAnalyser>(pNode, this, m_reporter, m_libraryScope, pAnchor);
+        case k_mxl_tag_words:                  return analyse_with<WordsMxlAnalyser>(pNode, this, m_reporter, m_libraryScope, pAnchor);
         default:
-            return LOMSE_NEW NullMxlAnalyser(this, m_reporter, m_libraryScope, name);
+            return analyse_with<NullMxlAnalyser>(pNode, this, m_reporter, m_libraryScope,
+                                                 pNode->name());
     }
 }
 
 //---------------------------------------------------------------------------------------
-int MxlAnalyser::name_to_enum(const string& name) const
+int MxlAnalyser::name_to_enum(const char* name) const
 {
-	map<string, int>::const_iterator it = m_NameToEnum.find(name);
-	if (it != m_NameToEnum.end())
-		return it->second;
-    else
-        return k_mxl_tag_undefined;
+    static const MxlTagsTable table;
+    return table.find(name);
 }
 
 
@@ -84,23 +84,46 @@ ImoDocument* MxlCompiler::compile_file(const std::string& filename)
 {
     m_fileLocator = filename;
     DocLocator locator(m_fileLocator);
-    if (locator.get_inner_protocol() == DocLocator::k_zip)
+
+    //compressed MusicXML file (.mxl) given without entry
+    bool fCompressed = (locator.get_inner_protocol() == DocLocator::k_zip);
+    if (!fCompressed && is_compressed_musicxml(filename))
+    {
+        m_fileLocator += "#zip:";
+        fCompressed = true;
+    }
+
+    if (fCompressed)
     {
 #if (LOMSE_ENABLE_COMPRESSION == 1)
         InputStream* pFile = FileSystem::open_input_stream(m_fileLocator);
         ZipInputStream* zip  = static_cast<ZipInputStream*>(pFile);
 
-        unsigned char* buffer = zip->get_as_string();
-        m_pXmlParser->parse_cstring( (char *)buffer );
+        bool fOpen = zip->is_open();
+        if (locator.get_inner_fullpath().empty())
+            fOpen = move_to_rootfile(zip);
+
+        //decompress directly into the buffer used by the parser
+        if (fOpen)
+            m_pXmlParser->parse_input_stream(zip, size_t(zip->get_size()));
 
         delete pFile;
-        delete[] buffer;
+
+        if (!fOpen)
+        {
+            //the parser could contain container.xml or a previous document
+            m_pXmlParser->clear();
+            LOMSE_LOG_ERROR("No score found in compressed file '%s'", filename.c_str());
+            m_pXmlParser->report_error("No score found in compressed file '"
+                                       + filename + "'");
+            return nullptr;
+        }
 #else
 		throw runtime_error("Could not open compressed file: Lomse was compiled without compression support");
 #endif
     }
     else //k_file
-        m_pParser->parse_file(filename);
+        m_pXmlParser->parse_mapped_file(filename);
 
     XmlNode* root = m_pXmlParser->get_tree_root();
     if (root)
@@ -109,6 +132,54 @@ ImoDocument* MxlCompiler::compile_file(const std::string& filename)
         return nullptr;
 }
 
+//---------------------------------------------------------------------------------------
+bool MxlCompiler::is_compressed_musicxml(const std::string& filename)
+{
+    size_t length = filename.size();
+    return length > 4 && filename.compare(length - 4, 4, ".mxl") == 0;
+}
+
+#if (LOMSE_ENABLE_COMPRESSION == 1)
+//---------------------------------------------------------------------------------------
+bool MxlCompiler::move_to_rootfile(ZipInputStream* zip)
+{
+    //A compressed MusicXML file contains a META-INF/container.xml file. The first
+    //<rootfile> element in it points to the score. If missing, the score is assumed
+    //to be the first entry that is not the mimetype file or in META-INF folder.
+    //Returns false if no score entry could be opened
+
+    string rootfile;
+    if (zip->move_to_entry("META-INF/container.xml") && zip->open_current_entry())
+    {
+        m_pXmlParser->parse_input_stream(zip, size_t(zip->get_size()));
+        XmlNode* root = m_pXmlParser->get_tree_root();
+        if (root && !root->is_null())
+        {
+            XmlNode node = root->child("rootfiles").child("rootfile");
+            if (!node.is_null())
+                rootfile = node.attribute_value("full-path");
+        }
+    }
+
+    if (!rootfile.empty() && zip->move_to_entry(rootfile))
+        return zip->open_current_entry();
+
+    bool fFound = zip->move_to_first_entry();
+    while (fFound)
+    {
+        ZipEntryInfo info;
+        zip->get_current_entry_info(info);
+        if (!info.bFolder && info.filename != "mimetype"
+            && info.filename.compare(0, 9, "META-INF/") != 0)
+        {
+            return zip->open_current_entry();
+        }
+        fFound = zip->move_to_next_entry();
+    }
+    return false;
+}
+#endif
+
 //---------------------------------------------------------------------------------------
 ImoDocument* MxlCompiler::compile_string(const std::string& source)
 {
@@ -117,6 +117,11 @@ Renderer* RendererFactory::create_renderer(LibraryScope& libraryScope,
                                         PixFormat_bgra32::color_type>
                             (libraryScope.get_screen_ppi(), attr_storage, path);
 
+        case k_pix_format_bgra32_pre:
+            return LOMSE_NEW RendererTemplate<PixFormat_bgra32_pre,
+                                        PixFormat_bgra32_pre::color_type>
+                            (libraryScope.get_screen_ppi(), attr_storage, path);
+
         //case k_pix_format_rgb48:
         //    return LOMSE_NEW RendererTemplate<PixFormat_rgb48>(libraryScope.get_screen_ppi(),
         //                                                 attr_storage, path);
@@ -206,7 +206,7 @@ ChannelComponent::ChannelComponent (PianoController& pianoController, PianoContr
 	volumeSlider->setScrollWheelEnabled(!scrollable);
 
     pianoController.AddListener(this);
-    updateChannelState(PianoController::apActive);
+    updateChannelState();
     //[/Constructor]
 }
 
@@ -238,6 +238,7 @@ ChannelComponent::~ChannelComponent()
 void ChannelComponent::paint (Graphics& g)
 {
     //[UserPrePaint] Add your own custom painting code here..
+    Painted();
     //[/UserPrePaint]
 
     g.fillAll (Colour (0xff323e44));
@@ -320,41 +321,64 @@ void ChannelComponent::sliderValueChanged (Slider* sliderThatWasMoved)
 
 
 //[MiscUserCode] You can add your own definitions of your custom methods or any other code here...
-void ChannelComponent::updateChannelState(PianoController::Aspect aspect)
+void ChannelComponent::updateChannelState(uint32 aspects)
 {
 	bool enabled = pianoController.GetEnabled(channel) && pianoController.IsConnected();
 	bool active = pianoController.GetActive(channel);
 
-	titleButton->setEnabled(enabled);
-	titleButton->setToggleState(enabled && active, NotificationType::dontSendNotification);
+	// enabled and active state affect all controls
+	if (HasAspect(aspects, PianoController::apConnection) ||
+		HasAspect(aspects, PianoController::apEnable) ||
+		HasAspect(aspects, PianoController::apActive))
+	{
+		aspects = AllAspects;
 
-	titleLabel->setEnabled(enabled);
+		titleButton->setEnabled(enabled);
+		titleButton->setToggleState(enabled && active, NotificationType::dontSendNotification);
 
-	voiceLabel->setText(enabled ? Presets::VoiceTitle(pianoController.GetVoice(channel)) : "",
-		NotificationType::dontSendNotification);
-	voiceLabel->setTooltip(voiceLabel->getText());
+		titleLabel->setEnabled(enabled);
 
-	panLabel->setEnabled(pianoController.IsConnected());
-	reverbLabel->setEnabled(pianoController.IsConnected());
-	volumeLabel->setEnabled(pianoController.IsConnected());
+		panLabel->setEnabled(pianoController.IsConnected());
+		reverbLabel->setEnabled(pianoController.IsConnected());
+		volumeLabel->setEnabled(pianoController.IsConnected());
 
-	panSlider->setEnabled(enabled && active && canPanAndReverb);
-	reverbSlider->setEnabled(enabled && active && canPanAndReverb);
-	volumeSlider->setEnabled(enabled && active);
+		panSlider->setEnabled(enabled && active && canPanAndReverb);
+		reverbSlider->setEnabled(enabled && active && canPanAndReverb);
+		volumeSlider->setEnabled(enabled && active);
 
-	panSlider->setValue(pianoController.GetPan(channel), NotificationType::dontSendNotification);
-	reverbSlider->setValue(pianoController.GetReverb(channel), NotificationType::dontSendNotification);
-	volumeSlider->setValue(pianoController.GetVolume(channel), NotificationType::dontSendNotification);
+		menuButton->setEnabled(enabled);
+		menuButton2->setEnabled(enabled);
+	}
 
-	menuButton->setEnabled(enabled);
-	menuButton2->setEnabled(enabled);
+	if (HasAspect(aspects, PianoController::apVoice))
+	{
+		voiceLabel->setText(enabled ? Presets::VoiceTitle(pianoController.GetVoice(channel)) : "",
+			NotificationType::dontSendNotification);
+		voiceLabel->setTooltip(voiceLabel->getText());
+	}
 
-	partLabel->setText(pianoController.GetPartChannel(PianoController::paRight) == channel ? "R" : "L",
-		NotificationType::dontSendNotification);
-	partLabel->setVisible(showMenuRow &&
-		(pianoController.GetPartChannel(PianoController::paRight) == channel ||
-		pianoController.GetPartChannel(PianoController::paLeft) == channel));
-	partLabel->setEnabled(enabled && active);
+	if (HasAspect(aspects, PianoController::apPan))
+	{
+		panSlider->setValue(pianoController.GetPan(channel), NotificationType::dontSendNotification);
+	}
+	if (HasAspect(aspects, PianoController::apReverb))
+	{
+		reverbSlider->setValue(pianoController.GetReverb(channel), NotificationType::dontSendNotification);
+	}
+	if (HasAspect(aspects, PianoController::apVolume))
+	{
+		volumeSlider->setValue(pianoController.GetVolume(channel), NotificationType::dontSendNotification);
+	}
+
+	if (HasAspect(aspects, PianoController::apPartChannel))
+	{
+		partLabel->setText(pianoController.GetPartChannel(PianoController::paRight) == channel ? "R" : "L",
+			NotificationType::dontSendNotification);
+		partLabel->setVisible(showMenuRow &&
+			(pianoController.GetPartChannel(PianoController::paRight) == channel ||
+			pianoController.GetPartChannel(PianoController::paLeft) == channel));
+		partLabel->setEnabled(enabled && active);
+	}
 }
 
 void ChannelComponent::mouseDoubleClick(const MouseEvent& event)
@@ -418,7 +442,7 @@ void ChannelComponent::showMenu(Button* button)
 		Voice* vc = Presets::FindVoice(pianoController.GetVoice(channel));
 		if (vc)
 		{
-			pianoController.SetVoice(PianoController::Channel(result - 100), vc->path);
+			pianoController.SetVoice(PianoController::Channel(result - 100), vc->GetPath());
 		}
 	}
 	else if (group == 2)
@@ -503,7 +527,7 @@ void ChannelComponent::toggleChannel()
 BEGIN_JUCER_METADATA
 
 <JUCER_COMPONENT documentType="Component" className="ChannelComponent" componentName=""
-                 parentClasses="public Component, public PianoController::Listener"
+                 parentClasses="public Component, public PianoController::Listener, public UiUpdater::Client"
                  constructorParams="PianoController&amp; pianoController, PianoController::Channel channel, String title, bool showLabels, bool canPanAndReverb, bool showMenu, bool shrinkMenu, bool scrollable"
                  variableInitialisers="pianoController(pianoController), channel(channel), title(title), canPanAndReverb(canPanAndReverb), showMenuRow(showMenu), shrinkMenu(shrinkMenu)"
                  snapPixels="8" snapActive="1" snapShown="1" overlayOpacity="0.330"
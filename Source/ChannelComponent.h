@@ -22,6 +22,7 @@
 //[Headers]     -- You can add your own extra header files here --
 #include <JuceHeader.h>
 #include "PianoController.h"
+#include "UiUpdater.h"
 //[/Headers]
 
 
@@ -36,6 +37,7 @@
 */
 class ChannelComponent  : public Component,
                           public PianoController::Listener,
+                          public UiUpdater::Client,
                           public Button::Listener,
                           public Slider::Listener
 {
@@ -47,8 +49,9 @@ public:
     //==============================================================================
     //[UserMethods]     -- You can add your own custom methods in this section.
     void PianoStateChanged(PianoController::Aspect ap, PianoController::Channel ch) override
-		{ if (ch == channel || ap == PianoController::apConnection) MessageManager::callAsync([=](){updateChannelState(ap);}); }
-	void updateChannelState(PianoController::Aspect aspect);
+		{ if (ch == channel || ap == PianoController::apConnection) Invalidate(ap); }
+	void UpdateState(uint32 aspects) override { updateChannelState(aspects); }
+	void updateChannelState(uint32 aspects = AllAspects);
     void mouseDoubleClick(const MouseEvent& event) override;
     void mouseUp(const MouseEvent& event) override;
 	void showMenu(Button* button);
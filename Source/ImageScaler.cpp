@@ -0,0 +1,127 @@
+/*
+ *  This file is part of ConPianist. See <https://github.com/hugbug/conpianist>.
+ *
+ *  Copyright (C) 2020 Andrey Prygunkov <hugbug@users.sourceforge.net>
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "ImageScaler.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+ #include <emmintrin.h>
+ #define IMAGESCALER_SSE2 1
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+ #include <arm_neon.h>
+ #define IMAGESCALER_NEON 1
+#endif
+
+// Weights have 7 bits, so that products of 8-bit channels fit into 16-bit lanes
+static const int WeightOne = 128;
+
+// Maps a destination coordinate to the source pixel and the weight of its right/lower neighbour
+static void MapCoordinate(int dst, double ratio, int srcSize, int& src, int& weight)
+{
+	const double pos = jlimit(0.0, double(srcSize - 1), (dst + 0.5) * ratio - 0.5);
+	src = int(pos);
+	weight = roundToInt((pos - src) * WeightOne);
+	if (weight == WeightOne)
+	{
+		src = jmin(src + 1, srcSize - 1);
+		weight = 0;
+	}
+}
+
+static inline uint32 BlendPixels(uint32 p00, uint32 p01, uint32 p10, uint32 p11, int fx, int fy)
+{
+#if IMAGESCALER_SSE2
+	const __m128i zero = _mm_setzero_si128();
+	// lanes 0..3 - upper row, lanes 4..7 - lower row
+	const __m128i left = _mm_unpacklo_epi8(_mm_unpacklo_epi32(
+		_mm_cvtsi32_si128(int(p00)), _mm_cvtsi32_si128(int(p10))), zero);
+	const __m128i right = _mm_unpacklo_epi8(_mm_unpacklo_epi32(
+		_mm_cvtsi32_si128(int(p01)), _mm_cvtsi32_si128(int(p11))), zero);
+	__m128i h = _mm_add_epi16(_mm_mullo_epi16(left, _mm_set1_epi16(short(WeightOne - fx))),
+		_mm_mullo_epi16(right, _mm_set1_epi16(short(fx))));
+	h = _mm_srli_epi16(_mm_add_epi16(h, _mm_set1_epi16(WeightOne / 2)), 7);
+	const __m128i wy = _mm_unpacklo_epi64(_mm_set1_epi16(short(WeightOne - fy)), _mm_set1_epi16(short(fy)));
+	__m128i v = _mm_mullo_epi16(h, wy);
+	v = _mm_add_epi16(v, _mm_srli_si128(v, 8));
+	v = _mm_srli_epi16(_mm_add_epi16(v, _mm_set1_epi16(WeightOne / 2)), 7);
+	return uint32(_mm_cvtsi128_si32(_mm_packus_epi16(v, zero)));
+#elif IMAGESCALER_NEON
+	// lanes 0..3 - upper row, lanes 4..7 - lower row
+	const uint16x8_t left = vmovl_u8(vcreate_u8(uint64(p00) | (uint64(p10) << 32)));
+	const uint16x8_t right = vmovl_u8(vcreate_u8(uint64(p01) | (uint64(p11) << 32)));
+	uint16x8_t h = vmlaq_u16(vmulq_u16(left, vdupq_n_u16(uint16(WeightOne - fx))),
+		right, vdupq_n_u16(uint16(fx)));
+	h = vrshrq_n_u16(h, 7);
+	const uint16x8_t v = vmulq_u16(h, vcombine_u16(vdup_n_u16(uint16(WeightOne - fy)), vdup_n_u16(uint16(fy))));
+	const uint16x4_t sum = vrshr_n_u16(vadd_u16(vget_low_u16(v), vget_high_u16(v)), 7);
+	return vget_lane_u32(vreinterpret_u32_u8(vmovn_u16(vcombine_u16(sum, sum))), 0);
+#else
+	uint32 result = 0;
+	for (int shift = 0; shift < 32; shift += 8)
+	{
+		const int top = (int((p00 >> shift) & 0xff) * (WeightOne - fx) +
+			int((p01 >> shift) & 0xff) * fx + WeightOne / 2) >> 7;
+		const int bottom = (int((p10 >> shift) & 0xff) * (WeightOne - fx) +
+			int((p11 >> shift) & 0xff) * fx + WeightOne / 2) >> 7;
+		const int channel = (top * (WeightOne - fy) + bottom * fy + WeightOne / 2) >> 7;
+		result |= uint32(channel) << shift;
+	}
+	return result;
+#endif
+}
+
+void ImageScaler::Scale(const Image::BitmapData& src, int srcHeight, Image::BitmapData& dst,
+	juce::Rectangle<int> dstArea)
+{
+	jassert(src.pixelFormat == Image::ARGB && dst.pixelFormat == Image::ARGB);
+
+	const int srcWidth = src.width;
+	srcHeight = jmin(srcHeight, src.height);
+	dstArea = dstArea.getIntersection({0, 0, dst.width, dst.height});
+	if (srcWidth <= 0 || srcHeight <= 0 || dstArea.isEmpty())
+	{
+		return;
+	}
+
+	const double ratioX = double(srcWidth) / dst.width;
+	const double ratioY = double(srcHeight) / dst.height;
+
+	// source column and weight for each destination column, the same for all rows
+	std::vector<int> columns((size_t)dstArea.getWidth());
+	std::vector<int> weights((size_t)dstArea.getWidth());
+	for (int i = 0; i < dstArea.getWidth(); i++)
+	{
+		MapCoordinate(dstArea.getX() + i, ratioX, srcWidth, columns[(size_t)i], weights[(size_t)i]);
+	}
+
+	for (int y = dstArea.getY(); y < dstArea.getBottom(); y++)
+	{
+		int y0, fy;
+		MapCoordinate(y, ratioY, srcHeight, y0, fy);
+		const uint32* upper = (const uint32*)src.getLinePointer(y0);
+		const uint32* lower = (const uint32*)src.getLinePointer(jmin(y0 + 1, srcHeight - 1));
+		uint32* out = (uint32*)dst.getPixelPointer(dstArea.getX(), y);
+
+		for (size_t i = 0; i < columns.size(); i++)
+		{
+			const int x0 = columns[i];
+			const int x1 = jmin(x0 + 1, srcWidth - 1);
+			out[i] = BlendPixels(upper[x0], upper[x1], lower[x0], lower[x1], weights[i], fy);
+		}
+	}
+}
@@ -0,0 +1,33 @@
+/*
+ *  This file is part of ConPianist. See <https://github.com/hugbug/conpianist>.
+ *
+ *  Copyright (C) 2020 Andrey Prygunkov <hugbug@users.sourceforge.net>
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "../JuceLibraryCode/JuceHeader.h"
+
+// Bilinear resampling of premultiplied 32-bit pixels (JUCE's native ARGB layout).
+// Premultiplied pixels can be interpolated channel by channel without conversion.
+// Uses SSE2 on x86, NEON on ARM and plain C++ elsewhere.
+class ImageScaler
+{
+public:
+	// Scales top srcHeight rows of src to the whole dst, only pixels inside dstArea are written
+	static void Scale(const Image::BitmapData& src, int srcHeight, Image::BitmapData& dst,
+		juce::Rectangle<int> dstArea);
+};
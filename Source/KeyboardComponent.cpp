@@ -92,12 +92,15 @@ KeyboardComponent::KeyboardComponent (PianoController& pianoController, Settings
 
 
     //[Constructor] You can add your own custom stuff here..
+	// drain notes received from piano at display refresh rate
+	startTimerHz(60);
     //[/Constructor]
 }
 
 KeyboardComponent::~KeyboardComponent()
 {
     //[Destructor_pre]. You can add your own custom destruction code here..
+	stopTimer();
     //[/Destructor_pre]
 
     midiKeyboardComponent = nullptr;
@@ -191,15 +194,48 @@ void KeyboardComponent::handleNoteOff(MidiKeyboardState *source, int midiChannel
 	}
 }
 
-void KeyboardComponent::PianoNoteMessage(const MidiMessage& message)
+void KeyboardComponent::timerCallback()
 {
-	if (message.isNoteOn())
+	processNoteEvents();
+}
+
+void KeyboardComponent::processNoteEvents()
+{
+	const double now = Time::getMillisecondCounterHiRes();
+
+	int count;
+	while ((count = pianoController.GetNoteQueue().Pop(noteEvents, numElementsInArray(noteEvents))) > 0)
 	{
-		keyState.noteOn(1, message.getNoteNumber(), 0.0001);
+		for (int i = 0; i < count; i++)
+		{
+			const NoteQueue::Event& event = noteEvents[i];
+
+			// tiny velocity marks notes coming from piano, they aren't sent back (see handleNoteOn)
+			if (event.noteOn)
+			{
+				keyState.noteOn(1, event.note, 0.0001);
+			}
+			else
+			{
+				keyState.noteOff(1, event.note, 0.0001);
+			}
+
+			const double latency = now - event.timestamp;
+			noteLatencyMax = jmax(noteLatencyMax, latency);
+			noteLatencySum += latency;
+			noteLatencyCount++;
+		}
 	}
-	else if (message.isNoteOff())
+
+	if (noteLatencyCount > 0 && now - noteLatencyReported > 1000)
 	{
-		keyState.noteOff(1, message.getNoteNumber(), 0.0001);
+		DBG("Note latency: average " << noteLatencySum / noteLatencyCount << " ms, maximum " <<
+			noteLatencyMax << " ms, frame " << getTimerInterval() << " ms, dropped " <<
+			pianoController.GetNoteQueue().GetDropped());
+		noteLatencyMax = 0;
+		noteLatencySum = 0;
+		noteLatencyCount = 0;
+		noteLatencyReported = now;
 	}
 }
 
@@ -242,7 +278,7 @@ void KeyboardComponent::updateEnabledControls()
 BEGIN_JUCER_METADATA
 
 <JUCER_COMPONENT documentType="Component" className="KeyboardComponent" componentName=""
-                 parentClasses="public Component, public MidiKeyboardStateListener, public PianoController::Listener, public ChangeListener"
+                 parentClasses="public Component, public MidiKeyboardStateListener, public PianoController::Listener, public ChangeListener, public Timer"
                  constructorParams="PianoController&amp; pianoController, Settings&amp; settings"
                  variableInitialisers="pianoController(pianoController), settings(settings)"
                  snapPixels="8" snapActive="1" snapShown="1" overlayOpacity="0.330"
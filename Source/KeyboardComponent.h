@@ -39,6 +39,7 @@ class KeyboardComponent  : public Component,
                            public MidiKeyboardStateListener,
                            public PianoController::Listener,
                            public ChangeListener,
+                           public Timer,
                            public ComboBox::Listener
 {
 public:
@@ -50,8 +51,8 @@ public:
     //[UserMethods]     -- You can add your own custom methods in this section.
     void handleNoteOn(MidiKeyboardState *source, int midiChannel, int midiNoteNumber, float velocity) override;
     void handleNoteOff(MidiKeyboardState *source, int midiChannel, int midiNoteNumber, float velocity) override;
-	void PianoNoteMessage(const MidiMessage& message) override;
     void changeListenerCallback(ChangeBroadcaster* source) override;
+    void timerCallback() override;
 	void applySettings();
     void PianoStateChanged(PianoController::Aspect aspect, PianoController::Channel channel) override
     	{ if (aspect == PianoController::apConnection) MessageManager::callAsync([=](){updateKeyboardState();}); }
@@ -70,6 +71,13 @@ private:
 	MidiKeyboardState keyState;
     PianoController& pianoController;
     Settings& settings;
+	NoteQueue::Event noteEvents[256];
+	double noteLatencyMax = 0;
+	double noteLatencySum = 0;
+	int noteLatencyCount = 0;
+	double noteLatencyReported = 0;
+
+	void processNoteEvents();
     //[/UserVariables]
 
     //==============================================================================
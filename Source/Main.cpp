@@ -11,6 +11,8 @@
 #include "../JuceLibraryCode/JuceHeader.h"
 #include "LookAndFeel.h"
 #include "SceneComponent.h"
+#include "PianoSimulator.h"
+#include "ScoreBenchmark.h"
 
 //==============================================================================
 class ConnectedPianistApplication  : public JUCEApplication
@@ -30,6 +32,35 @@ public:
     {
         // This method is where you should put your application's initialisation code..
 
+		// Headless mode for testing without real piano:
+		//   --simulate-piano [--sim-pianos=N] [--sim-address=127.0.0.1]
+		//   [--sim-drop=%] [--sim-reorder=%] [--sim-latency=ms] [--sim-jitter=ms]
+		//   [--sim-notes=per-second] [--sim-stats=seconds]
+		PianoSimulator::Options simulatorOptions;
+		if (PianoSimulator::ParseCommandLine(commandLine, simulatorOptions))
+		{
+			pianoSimulator.reset(new PianoSimulator(simulatorOptions));
+			if (!pianoSimulator->Start())
+			{
+				setApplicationReturnValue(1);
+				quit();
+			}
+			return;
+		}
+
+		// Headless benchmark of score loading and rendering:
+		//   --benchmark-score [--bench-sizes=800x600,1920x1080] [--bench-scales=1,2]
+		//   [--bench-repeat=N] [--bench-arena=0|1] [--bench-threads=N] [--bench-edits=N]
+		//   [score files or directories...]
+		ScoreBenchmark::Options benchmarkOptions;
+		if (ScoreBenchmark::ParseCommandLine(commandLine, benchmarkOptions))
+		{
+			Settings settings;
+			setApplicationReturnValue(ScoreBenchmark(benchmarkOptions).Run(settings.resourcesPath));
+			quit();
+			return;
+		}
+
 #if TARGET_OS_IPHONE
 		Desktop::getInstance().setGlobalScaleFactor(1.2);
 		CreateSharedDocumenstDirectory();
@@ -46,6 +77,7 @@ public:
         // Add your application's shutdown code here..
 
         mainWindow = nullptr; // (deletes our window)
+		pianoSimulator = nullptr;
     }
 
     //==============================================================================
@@ -135,6 +167,7 @@ public:
 
 private:
     std::unique_ptr<MainWindow> mainWindow;
+	std::unique_ptr<PianoSimulator> pianoSimulator;
 };
 
 //==============================================================================
@@ -72,7 +72,11 @@ public:
 
 	uint16_t remotePort() { return m_remotePort; }
 
-private:
+	// Waits until a packet is available for reading or the timeout expires.
+	// Returns: true if a packet is available.
+	bool waitForPacket(int timeoutMsecs) { return m_socket.waitUntilReady(true, timeoutMsecs) == 1; }
+
+protected:
 	appleMidi::IPAddress m_remoteIp;
 	uint16_t m_remotePort = 0;
 	juce::DatagramSocket m_socket;
@@ -104,6 +104,7 @@ MixerComponent::~MixerComponent()
 void MixerComponent::paint (Graphics& g)
 {
     //[UserPrePaint] Add your own custom painting code here..
+    Painted();
     //[/UserPrePaint]
 
     g.fillAll (Colour (0xff323e44));
@@ -158,9 +159,12 @@ void MixerComponent::comboBoxChanged (ComboBox* comboBoxThatHasChanged)
 
 
 //[MiscUserCode] You can add your own definitions of your custom methods or any other code here...
-void MixerComponent::updateReverbEffectState()
+void MixerComponent::updateReverbEffectState(uint32 aspects)
 {
-	effectComboBox->setEnabled(pianoController.IsConnected());
+	if (HasAspect(aspects, PianoController::apConnection))
+	{
+		effectComboBox->setEnabled(pianoController.IsConnected());
+	}
 	effectComboBox->setSelectedId(pianoController.GetReverbEffect() + 1000000, NotificationType::dontSendNotification);
 	if (effectComboBox->getSelectedId() != pianoController.GetReverbEffect() + 1000000)
 	{
@@ -180,7 +184,7 @@ void MixerComponent::updateReverbEffectState()
 BEGIN_JUCER_METADATA
 
 <JUCER_COMPONENT documentType="Component" className="MixerComponent" componentName=""
-                 parentClasses="public Component, public PianoController::Listener"
+                 parentClasses="public Component, public PianoController::Listener, public UiUpdater::Client"
                  constructorParams="PianoController&amp; pianoController" variableInitialisers="pianoController(pianoController)"
                  snapPixels="8" snapActive="1" snapShown="1" overlayOpacity="0.330"
                  fixedSize="0" initialWidth="600" initialHeight="400">
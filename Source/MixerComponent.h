@@ -22,6 +22,7 @@
 //[Headers]     -- You can add your own extra header files here --
 #include <JuceHeader.h>
 #include "PianoController.h"
+#include "UiUpdater.h"
 //[/Headers]
 
 #include "ChannelComponent.h"
@@ -37,6 +38,7 @@
 */
 class MixerComponent  : public Component,
                         public PianoController::Listener,
+                        public UiUpdater::Client,
                         public ComboBox::Listener
 {
 public:
@@ -48,8 +50,9 @@ public:
     //[UserMethods]     -- You can add your own custom methods in this section.
     void PianoStateChanged(PianoController::Aspect ap, PianoController::Channel ch) override
 		{ if (ap == PianoController::apConnection || ap == PianoController::apReverbEffect)
-			MessageManager::callAsync([=](){updateReverbEffectState();}); }
-	void updateReverbEffectState();
+			Invalidate(ap); }
+	void UpdateState(uint32 aspects) override { updateReverbEffectState(aspects); }
+	void updateReverbEffectState(uint32 aspects = AllAspects);
     //[/UserMethods]
 
     void paint (Graphics& g) override;
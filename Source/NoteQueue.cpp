@@ -0,0 +1,54 @@
+/*
+ *  This file is part of ConPianist. See <https://github.com/hugbug/conpianist>.
+ *
+ *  Copyright (C) 2020 Andrey Prygunkov <hugbug@users.sourceforge.net>
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "NoteQueue.h"
+
+bool NoteQueue::Push(const MidiMessage& message, double timestamp)
+{
+	int start1, size1, start2, size2;
+	m_fifo.prepareToWrite(1, start1, size1, start2, size2);
+
+	if (size1 + size2 < 1)
+	{
+		m_dropped++;
+		return false;
+	}
+
+	Event& event = m_events[(size_t)(size1 > 0 ? start1 : start2)];
+	event.noteOn = message.isNoteOn();
+	event.channel = (uint8)message.getChannel();
+	event.note = (uint8)message.getNoteNumber();
+	event.velocity = message.getVelocity();
+	event.timestamp = timestamp;
+
+	m_fifo.finishedWrite(1);
+	return true;
+}
+
+int NoteQueue::Pop(Event* events, int maxEvents)
+{
+	int start1, size1, start2, size2;
+	m_fifo.prepareToRead(maxEvents, start1, size1, start2, size2);
+
+	std::copy_n(m_events.begin() + start1, size1, events);
+	std::copy_n(m_events.begin() + start2, size2, events + size1);
+
+	m_fifo.finishedRead(size1 + size2);
+	return size1 + size2;
+}
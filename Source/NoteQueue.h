@@ -0,0 +1,48 @@
+/*
+ *  This file is part of ConPianist. See <https://github.com/hugbug/conpianist>.
+ *
+ *  Copyright (C) 2020 Andrey Prygunkov <hugbug@users.sourceforge.net>
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "../JuceLibraryCode/JuceHeader.h"
+
+// Lock-free single producer, single consumer queue for note messages.
+// Written by the network thread, drained by UI at display refresh rate.
+// Doesn't allocate after construction; if the queue is full new events are dropped.
+class NoteQueue
+{
+public:
+	struct Event
+	{
+		bool noteOn;
+		uint8 channel;
+		uint8 note;
+		uint8 velocity;
+		double timestamp; // when the message was received, Time::getMillisecondCounterHiRes()
+	};
+
+	NoteQueue(int capacity = 1024) : m_fifo(capacity), m_events((size_t)capacity) {}
+	bool Push(const MidiMessage& message, double timestamp);
+	int Pop(Event* events, int maxEvents);
+	int GetDropped() { return m_dropped; }
+
+private:
+	AbstractFifo m_fifo;
+	std::vector<Event> m_events;
+	std::atomic<int> m_dropped{0};
+};
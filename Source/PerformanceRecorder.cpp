@@ -0,0 +1,190 @@
+/*
+ *  This file is part of ConPianist. See <https://github.com/hugbug/conpianist>.
+ *
+ *  Copyright (C) 2020 Andrey Prygunkov <hugbug@users.sourceforge.net>
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "PerformanceRecorder.h"
+
+PerformanceRecorder::PerformanceRecorder(PianoController& pianoController) :
+	Thread("PerformanceRecorder"), m_pianoController(pianoController)
+{
+	m_pianoController.AddListener(this);
+}
+
+PerformanceRecorder::~PerformanceRecorder()
+{
+	m_pianoController.RemoveListener(this);
+	Stop();
+}
+
+File PerformanceRecorder::DefaultFile()
+{
+	File docPath = File::getSpecialLocation(File::userDocumentsDirectory);
+	return docPath.getNonexistentChildFile("Performance " +
+		Time::getCurrentTime().formatted("%Y-%m-%d %H-%M"), ".mid", false);
+}
+
+bool PerformanceRecorder::Start(const File& file)
+{
+	Stop();
+
+	file.deleteFile();
+	m_stream.reset(file.createOutputStream());
+	if (!m_stream)
+	{
+		return false;
+	}
+
+	m_file = file;
+
+	// header chunk: format 0, one track
+	m_stream->write("MThd", 4);
+	WriteBigEndian(6, 4);
+	WriteBigEndian(0, 2);
+	WriteBigEndian(1, 2);
+	WriteBigEndian(TicksPerQuarter, 2);
+
+	// track chunk, length is written when recording stops
+	m_stream->write("MTrk", 4);
+	m_trackStart = m_stream->getPosition();
+	WriteBigEndian(0, 4);
+
+	// tempo 120 bpm
+	const uint8 tempo[] = {0x00, 0xff, 0x51, 0x03, 0x07, 0xa1, 0x20};
+	m_stream->write(tempo, sizeof(tempo));
+
+	m_fifo.reset();
+	m_startTime = Time::getMillisecondCounterHiRes();
+	m_lastTick = 0;
+	m_recording = true;
+
+	startThread();
+	return true;
+}
+
+void PerformanceRecorder::Stop()
+{
+	if (!m_recording)
+	{
+		return;
+	}
+
+	m_recording = false;
+	signalThreadShouldExit();
+	notify();
+	stopThread(2000);
+	WriteEvents();
+
+	// end of track
+	const uint8 endOfTrack[] = {0x00, 0xff, 0x2f, 0x00};
+	m_stream->write(endOfTrack, sizeof(endOfTrack));
+
+	const int64 trackEnd = m_stream->getPosition();
+	m_stream->setPosition(m_trackStart);
+	WriteBigEndian((uint32)(trackEnd - m_trackStart - 4), 4);
+	m_stream->flush();
+	m_stream.reset();
+}
+
+void PerformanceRecorder::PianoNoteMessage(const MidiMessage& message)
+{
+	// called on network thread: no locks, no allocations
+	if (!m_recording || message.getRawDataSize() > 3 || message.isSysEx() || message.getRawData()[0] >= 0xf0)
+	{
+		return;
+	}
+
+	int start1, size1, start2, size2;
+	m_fifo.prepareToWrite(1, start1, size1, start2, size2);
+
+	if (size1 + size2 < 1)
+	{
+		m_dropped++;
+		return;
+	}
+
+	Event& event = m_events[size1 > 0 ? start1 : start2];
+	event.timestamp = message.getTimeStamp() > 0 ?
+		message.getTimeStamp() * 1000 : Time::getMillisecondCounterHiRes();
+	event.size = (uint8)message.getRawDataSize();
+	memcpy(event.data, message.getRawData(), event.size);
+
+	m_fifo.finishedWrite(1);
+}
+
+void PerformanceRecorder::run()
+{
+	while (!threadShouldExit())
+	{
+		WriteEvents();
+		wait(250);
+	}
+}
+
+void PerformanceRecorder::WriteEvents()
+{
+	int start1, size1, start2, size2;
+	m_fifo.prepareToRead(Capacity, start1, size1, start2, size2);
+
+	auto writeBlock = [&](int start, int size)
+		{
+			for (int i = start; i < start + size; i++)
+			{
+				// ticks are counted from start to avoid accumulating rounding errors
+				const Event& event = m_events[i];
+				const int64 tick = jmax(m_lastTick, (int64)roundToInt(event.timestamp - m_startTime));
+				WriteVarLen((uint32)(tick - m_lastTick));
+				m_lastTick = tick;
+				m_stream->write(event.data, event.size);
+			}
+		};
+
+	writeBlock(start1, size1);
+	writeBlock(start2, size2);
+
+	m_fifo.finishedRead(size1 + size2);
+
+	if (size1 + size2 > 0)
+	{
+		m_stream->flush();
+	}
+}
+
+void PerformanceRecorder::WriteVarLen(uint32 value)
+{
+	uint8 buf[5];
+	int len = 0;
+
+	buf[len++] = value & 0x7f;
+	while ((value >>= 7) > 0)
+	{
+		buf[len++] = (value & 0x7f) | 0x80;
+	}
+
+	while (len > 0)
+	{
+		m_stream->writeByte((char)buf[--len]);
+	}
+}
+
+void PerformanceRecorder::WriteBigEndian(uint32 value, int bytes)
+{
+	for (int i = bytes - 1; i >= 0; i--)
+	{
+		m_stream->writeByte((char)((value >> (i * 8)) & 0xff));
+	}
+}
@@ -0,0 +1,69 @@
+/*
+ *  This file is part of ConPianist. See <https://github.com/hugbug/conpianist>.
+ *
+ *  Copyright (C) 2020 Andrey Prygunkov <hugbug@users.sourceforge.net>
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "../JuceLibraryCode/JuceHeader.h"
+
+#include "PianoController.h"
+
+// Records notes, pedals and other channel messages played on piano into a Standard MIDI File.
+// Messages are put into a preallocated lock-free ring on the network thread
+// and streamed to disk by a background writer, memory usage doesn't grow with recording length.
+class PerformanceRecorder : public PianoController::Listener, private Thread
+{
+public:
+	PerformanceRecorder(PianoController& pianoController);
+	~PerformanceRecorder();
+	bool Start(const File& file);
+	void Stop();
+	bool IsRecording() { return m_recording; }
+	const File& GetFile() { return m_file; }
+	int GetDropped() { return m_dropped; }
+	void PianoNoteMessage(const MidiMessage& message) override;
+
+	static File DefaultFile();
+
+private:
+	static const int TicksPerQuarter = 500; // with default tempo 120 bpm one tick is one millisecond
+	static const int Capacity = 4096;
+
+	struct Event
+	{
+		double timestamp; // milliseconds
+		uint8 data[3];
+		uint8 size;
+	};
+
+	PianoController& m_pianoController;
+	AbstractFifo m_fifo{Capacity};
+	Event m_events[Capacity];
+	std::atomic<bool> m_recording{false};
+	std::atomic<int> m_dropped{0};
+	File m_file;
+	std::unique_ptr<FileOutputStream> m_stream;
+	int64 m_trackStart = 0;
+	double m_startTime = 0;
+	int64 m_lastTick = 0;
+
+	void run() override;
+	void WriteEvents();
+	void WriteVarLen(uint32 value);
+	void WriteBigEndian(uint32 value, int bytes);
+};
@@ -486,6 +486,24 @@ void PianoController::SetActive(Channel ch, bool active)
 
 void PianoController::IncomingMidiMessage(const MidiMessage& message)
 {
+	// Notes are the most frequent and latency-critical messages,
+	// check them first and pass to UI via queue
+	if (message.isNoteOnOrOff())
+	{
+		double timestamp = message.getTimeStamp() > 0 ?
+			message.getTimeStamp() * 1000 : Time::getMillisecondCounterHiRes();
+		m_noteQueue.Push(message, timestamp);
+		NotifyNoteMessage(message);
+		return;
+	}
+
+	// pedals
+	if (message.isController())
+	{
+		NotifyNoteMessage(message);
+		return;
+	}
+
 	if (message.isSysEx() &&
 		PianoMessage::IsCspMessage(message.getSysExData(), message.getSysExDataSize()))
 	{
@@ -657,10 +675,6 @@ void PianoController::IncomingMidiMessage(const MidiMessage& message)
 
 		lastMessage = std::move(pm);
 	}
-	else if (message.isNoteOnOrOff())
-	{
-		NotifyNoteMessage(message);
-	}
 }
 
 void PianoController::AddListener(Listener* listener)
@@ -22,6 +22,7 @@
 #include "../JuceLibraryCode/JuceHeader.h"
 
 #include "MidiConnector.h"
+#include "NoteQueue.h"
 
 class PianoMessage;
 
@@ -141,6 +142,7 @@ public:
 	public:
 		virtual ~Listener() {}
 		virtual void PianoStateChanged(Aspect aspect, Channel channel) {}
+		// Notes and controller messages (pedals) played on piano; called on network thread
 		virtual void PianoNoteMessage(const MidiMessage& message) {}
 	};
 
@@ -214,6 +216,7 @@ public:
 	int GetReverbEffect() { return m_reverbEffect; }
 	void SetReverbEffect(int effect);
 	const String& GetSongName() { return m_songName; }
+	NoteQueue& GetNoteQueue() { return m_noteQueue; }
 
 	void SendMidiMessage(const MidiMessage& message);
 	void IncomingMidiMessage(const MidiMessage& message) override;
@@ -245,6 +248,7 @@ private:
 	String m_songName;
 	bool m_songLoaded = false;
 	std::unique_ptr<PianoMessage> lastMessage;
+	NoteQueue m_noteQueue;
 
 	void SendCspMessage(const PianoMessage& message);
 	void NotifyChanged(Aspect aspect, Channel channel = chNone);
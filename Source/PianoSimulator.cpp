@@ -0,0 +1,852 @@
+/*
+ *  This file is part of ConPianist. See <https://github.com/hugbug/conpianist>.
+ *
+ *  Copyright (C) 2020 Andrey Prygunkov <hugbug@users.sourceforge.net>
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../JuceLibraryCode/JuceHeader.h"
+#include "AppleMidi.h"
+#include "MidiSocket.h"
+#include "PianoController.h"
+#include "PianoMessage.h"
+#include "PianoSimulator.h"
+
+// UDP socket with configurable network impairments: packet loss, delay, jitter and reordering.
+// Outgoing packets are held in a queue until due, the owner must call SendDelayedPackets() regularly.
+class ImpairedSocket : public appleMidi::MidiSocket
+{
+public:
+	void Configure(const String& bindAddress, const PianoSimulator::Impairment& impairment);
+	int begin(int localPort);
+	int endPacket();
+	int read(unsigned char* buffer, size_t len);
+	void SendDelayedPackets();
+	bool IsBound() { return m_bound; }
+	int GetDropped() { return m_dropped; }
+	// when the last outgoing packet leaves the socket (in future if delayed), 0 if it was dropped
+	double GetLastSendTime() { return m_lastSendTime; }
+
+private:
+	struct DelayedPacket
+	{
+		double due;
+		String ip;
+		int port;
+		std::vector<byte> data;
+	};
+
+	String m_bindAddress;
+	PianoSimulator::Impairment m_impairment;
+	Random m_random;
+	std::vector<DelayedPacket> m_delayed;
+	double m_lastDue = 0;
+	double m_lastSendTime = 0;
+	bool m_bound = false;
+	std::atomic<int> m_dropped{0};
+};
+
+void ImpairedSocket::Configure(const String& bindAddress, const PianoSimulator::Impairment& impairment)
+{
+	m_bindAddress = bindAddress;
+	m_impairment = impairment;
+}
+
+int ImpairedSocket::begin(int localPort)
+{
+	m_bound = m_socket.bindToPort(localPort, m_bindAddress);
+	return m_bound;
+}
+
+int ImpairedSocket::endPacket()
+{
+	if (m_random.nextFloat() < m_impairment.dropRate)
+	{
+		m_dropped++;
+		m_lastSendTime = 0;
+		return 1;
+	}
+
+	const double now = Time::getMillisecondCounterHiRes();
+	double due = now + m_impairment.latency +
+		(m_impairment.jitter > 0 ? m_random.nextInt(m_impairment.jitter + 1) : 0);
+
+	if (m_random.nextFloat() < m_impairment.reorderRate)
+	{
+		// hold the packet long enough for the following packets to overtake it
+		due += m_impairment.jitter + 20;
+	}
+	else
+	{
+		// jitter alone must not change the order of packets
+		due = jmax(due, m_lastDue);
+		m_lastDue = due;
+	}
+
+	m_lastSendTime = jmax(due, now);
+
+	if (due <= now && m_delayed.empty())
+	{
+		return MidiSocket::endPacket();
+	}
+
+	m_delayed.push_back({due, String(m_remoteIp.host), m_remotePort, m_packet});
+	return 1;
+}
+
+int ImpairedSocket::read(unsigned char* buffer, size_t len)
+{
+	int ret = MidiSocket::read(buffer, len);
+
+	if (ret > 0 && m_random.nextFloat() < m_impairment.dropRate)
+	{
+		m_dropped++;
+		return 0;
+	}
+
+	return ret;
+}
+
+void ImpairedSocket::SendDelayedPackets()
+{
+	const double now = Time::getMillisecondCounterHiRes();
+
+	for (auto it = m_delayed.begin(); it != m_delayed.end();)
+	{
+		if (it->due <= now)
+		{
+			m_socket.write(it->ip, it->port, it->data.data(), (int)it->data.size());
+			it = m_delayed.erase(it);
+		}
+		else
+		{
+			++it;
+		}
+	}
+}
+
+class PianoSimulator::Piano : public Thread
+{
+public:
+	Piano(const String& address, const Options& options);
+	~Piano();
+	bool Start();
+	void run() override;
+	const String& GetAddress() { return m_address; }
+	Statistics GetStatistics();
+
+private:
+	class Session;
+
+	class UploadListener : public Thread
+	{
+	public:
+		UploadListener(Piano& piano) : Thread("PianoSimulator Upload"), m_piano(piano) {}
+		bool Start(const String& address);
+		void Stop();
+		void run() override;
+
+	private:
+		Piano& m_piano;
+		StreamingSocket m_listener;
+
+		void ReceiveSong(StreamingSocket& connection);
+	};
+
+	using ValueKey = std::pair<int, int>;
+
+	String m_address;
+	Options m_options;
+	std::unique_ptr<Session> m_session;
+	UploadListener m_uploadListener{*this};
+	std::map<ValueKey, MemoryBlock> m_values;
+	std::set<int> m_events;
+	Random m_random;
+	bool m_playing = false;
+	double m_nextBeat = 0;
+	double m_lastSensing = 0;
+	double m_nextNote = 0;
+	int m_lastNote = -1;
+
+	CriticalSection m_statsLock;
+	Statistics m_stats;
+	double m_invitationTime = 0;
+	double m_lastRequestTime = 0;
+	double m_burstStart = 0;
+	double m_latencySum = 0;
+
+	CriticalSection m_uploadLock;
+	StringArray m_uploadedSongs;
+
+	void InvitationReceived();
+	void IncomingCspMessage(const PianoMessage& message);
+	void SongUploaded(const String& songName);
+	void ProcessUploads();
+	void Playback(double now);
+	void PlayNotes(double now);
+	void SendValue(const Action action, const Property& property, int index, double requestTime = 0);
+	void NotifyValue(const Property& property, int index = 0);
+	MemoryBlock GetValue(const Property& property, int index);
+	int GetIntValue(const Property& property, int index);
+	void SetValue(const Property& property, int index, const MemoryBlock& value);
+	MemoryBlock DefaultValue(const Property& property, int index);
+};
+
+class PianoSimulator::Piano::Session : public appleMidi::AppleMidi_Class<ImpairedSocket>
+{
+public:
+	Session(Piano& piano) : m_piano(piano) {}
+	void Configure(const String& address, const Impairment& impairment);
+	bool IsBound() { return _controlPort.IsBound() && _dataPort.IsBound(); }
+	bool IsConnected() { return GetFreeSessionSlot() != 0; }
+	void SendDelayedPackets();
+	int GetDropped() { return _controlPort.GetDropped() + _dataPort.GetDropped(); }
+	double GetLastSendTime() { return _dataPort.GetLastSendTime(); }
+	void SendCspMessage(const PianoMessage& message);
+	void OnControlInvitation(void* sender, appleMidi::AppleMIDI_Invitation& invitation) override;
+	void OnSysEx(void* sender, const byte* data, uint16_t size) override;
+
+private:
+	Piano& m_piano;
+	std::vector<byte> m_buf;
+};
+
+void PianoSimulator::Piano::Session::Configure(const String& address, const Impairment& impairment)
+{
+	_controlPort.Configure(address, impairment);
+	_dataPort.Configure(address, impairment);
+}
+
+void PianoSimulator::Piano::Session::SendDelayedPackets()
+{
+	_controlPort.SendDelayedPackets();
+	_dataPort.SendDelayedPackets();
+}
+
+void PianoSimulator::Piano::Session::SendCspMessage(const PianoMessage& message)
+{
+	const MemoryBlock& data = message.GetSysExData();
+	std::vector<byte> buf(data.getSize() + 2);
+	buf.front() = 0xf0;
+	memcpy(buf.data() + 1, data.getData(), data.getSize());
+	buf.back() = 0xf7;
+	sysEx(buf.data(), (uint16_t)buf.size());
+}
+
+void PianoSimulator::Piano::Session::OnControlInvitation(void* sender, appleMidi::AppleMIDI_Invitation& invitation)
+{
+	appleMidi::AppleMidi_Class<ImpairedSocket>::OnControlInvitation(sender, invitation);
+	m_piano.InvitationReceived();
+}
+
+void PianoSimulator::Piano::Session::OnSysEx(void* sender, const byte* data, uint16_t size)
+{
+	if (data[0] == 0xf0)
+	{
+		m_buf.clear();
+	}
+
+	m_buf.insert(m_buf.end(), data, data + size);
+
+	if (data[size-1] == 0xf7 && m_buf.size() > 2 && m_buf.front() == 0xf0)
+	{
+		const uint8_t* sysExData = m_buf.data() + 1;
+		const int sysExSize = (int)m_buf.size() - 2;
+		if (PianoMessage::IsCspMessage(sysExData, sysExSize))
+		{
+			m_piano.IncomingCspMessage(PianoMessage(sysExData, sysExSize));
+		}
+		m_buf.clear();
+	}
+}
+
+PianoSimulator::Piano::Piano(const String& address, const Options& options) :
+	Thread("PianoSimulator " + address), m_address(address), m_options(options)
+{
+}
+
+PianoSimulator::Piano::~Piano()
+{
+	m_uploadListener.Stop();
+	stopThread(2000);
+}
+
+bool PianoSimulator::Piano::Start()
+{
+	m_session.reset(new Session(*this));
+	m_session->Configure(m_address, m_options.impairment);
+	m_session->begin("Clavinova", 5004);
+
+	if (!m_session->IsBound() || !m_uploadListener.Start(m_address))
+	{
+		return false;
+	}
+
+	startThread();
+	return true;
+}
+
+void PianoSimulator::Piano::run()
+{
+	while (!threadShouldExit())
+	{
+		// each call processes at most one packet per port
+		for (int i = 0; i < 32; i++)
+		{
+			m_session->run();
+		}
+
+		m_session->SendDelayedPackets();
+		ProcessUploads();
+
+		const double now = Time::getMillisecondCounterHiRes();
+
+		if (m_session->IsConnected())
+		{
+			if (now - m_lastSensing >= 300)
+			{
+				m_session->activeSensing();
+				m_lastSensing = now;
+			}
+
+			PlayNotes(now);
+		}
+
+		Playback(now);
+
+		Thread::sleep(1);
+	}
+}
+
+PianoSimulator::Statistics PianoSimulator::Piano::GetStatistics()
+{
+	const ScopedLock lock(m_statsLock);
+	Statistics stats = m_stats;
+	stats.dropped = m_session ? m_session->GetDropped() : 0;
+	return stats;
+}
+
+void PianoSimulator::Piano::InvitationReceived()
+{
+	const ScopedLock lock(m_statsLock);
+	m_stats.sessions++;
+	m_invitationTime = Time::getMillisecondCounterHiRes();
+}
+
+void PianoSimulator::Piano::IncomingCspMessage(const PianoMessage& message)
+{
+	const Action action = message.GetAction();
+	const Property property = message.GetProperty();
+	const int index = message.GetIndex();
+	const double now = Time::getMillisecondCounterHiRes();
+
+	{
+		const ScopedLock lock(m_statsLock);
+		m_stats.requests++;
+
+		if (m_invitationTime > 0)
+		{
+			m_stats.connectTime = (int)(now - m_invitationTime);
+			m_invitationTime = 0;
+		}
+
+		if (action == Action::Get)
+		{
+			// the app requests the whole state at once, consider requests
+			// coming with short pauses as one resync
+			if (now - m_lastRequestTime > 250)
+			{
+				m_burstStart = now;
+				m_stats.resyncRequests = 0;
+			}
+			m_lastRequestTime = now;
+			m_stats.resyncTime = (int)(now - m_burstStart);
+			m_stats.resyncRequests++;
+		}
+	}
+
+	if (action == Action::Get)
+	{
+		SendValue(Action::Info, property, index, now);
+	}
+	else if (action == Action::Set)
+	{
+		SetValue(property, index, MemoryBlock(message.GetRawValue(), (size_t)message.GetSize()));
+
+		if (property == Property::Play)
+		{
+			m_playing = GetIntValue(Property::Play, 0) == 1;
+			m_nextBeat = now;
+		}
+		else if (property == Property::SongReset)
+		{
+			m_playing = false;
+			m_values.clear();
+			NotifyValue(Property::SongName);
+			NotifyValue(Property::Length);
+			NotifyValue(Property::Position);
+			NotifyValue(Property::Play);
+			return;
+		}
+
+		SendValue(Action::Response, property, index, now);
+	}
+	else if (action == Action::Reset)
+	{
+		m_values.erase({property.signature, index});
+		SendValue(Action::Response, property, index, now);
+	}
+	else if (action == Action::Events)
+	{
+		m_events.insert(property.signature);
+	}
+}
+
+void PianoSimulator::Piano::SendValue(const Action action, const Property& property, int index, double requestTime)
+{
+	MemoryBlock value = GetValue(property, index);
+	m_session->SendCspMessage(PianoMessage(action, property, index,
+		(const uint8_t*)value.getData(), (int)value.getSize()));
+
+	const ScopedLock lock(m_statsLock);
+	m_stats.responses++;
+
+	// latency of a response to a request: from arrival of the request until the response
+	// leaves the socket, simulated network delay included; dropped responses are not counted
+	const double sendTime = m_session->GetLastSendTime();
+	if (requestTime > 0 && sendTime > 0)
+	{
+		const float latency = (float)(sendTime - requestTime);
+		m_latencySum += latency;
+		m_stats.latencyCount++;
+		m_stats.latencyLast = latency;
+		m_stats.latencyAvg = (float)(m_latencySum / m_stats.latencyCount);
+		m_stats.latencyMax = jmax(m_stats.latencyMax, latency);
+	}
+}
+
+void PianoSimulator::Piano::NotifyValue(const Property& property, int index)
+{
+	if (m_events.count(property.signature) > 0)
+	{
+		SendValue(Action::Info, property, index);
+	}
+}
+
+MemoryBlock PianoSimulator::Piano::GetValue(const Property& property, int index)
+{
+	auto pos = m_values.find({property.signature, index});
+	return pos != m_values.end() ? pos->second : DefaultValue(property, index);
+}
+
+int PianoSimulator::Piano::GetIntValue(const Property& property, int index)
+{
+	MemoryBlock value = GetValue(property, index);
+	int intValue = 0;
+	for (size_t i = 0; i < value.getSize(); i++)
+	{
+		intValue = (intValue << 7) + (uint8_t)value[i];
+	}
+	return intValue;
+}
+
+void PianoSimulator::Piano::SetValue(const Property& property, int index, const MemoryBlock& value)
+{
+	m_values[{property.signature, index}] = value;
+}
+
+MemoryBlock PianoSimulator::Piano::DefaultValue(const Property& property, int index)
+{
+	auto raw = [](const PianoMessage& message)
+		{
+			return MemoryBlock(message.GetRawValue(), (size_t)message.GetSize());
+		};
+
+	auto position = [](int measure, int beat)
+		{
+			uint8_t data[4] = {(uint8_t)(measure >> 7), (uint8_t)(measure & 0x7f),
+				(uint8_t)(beat >> 7), (uint8_t)(beat & 0x7f)};
+			return MemoryBlock(data, 4);
+		};
+
+	if (property == Property::PianoModel)
+	{
+		return raw(PianoMessage(Action::Info, Property::PianoModel, 0, String("CSP-170")));
+	}
+	else if (property == Property::FirmwareVersion)
+	{
+		return raw(PianoMessage(Action::Info, Property::FirmwareVersion, 0, String("1.10")));
+	}
+	else if (property == Property::VoicePreset)
+	{
+		return raw(PianoMessage(Action::Info, Property::VoicePreset, index,
+			String("PRESET:/VOICE/Piano/Grand Piano/CFX Grand.T542.VRM")));
+	}
+	else if (property == Property::SongName)
+	{
+		return MemoryBlock();
+	}
+	else if (property == Property::Length || property == Property::Position)
+	{
+		return position(1, 1);
+	}
+	else if (property == Property::Loop)
+	{
+		uint8_t data[9] = {0,0,1,0,1,0,2,0,1};
+		return MemoryBlock(data, 9);
+	}
+	else if (property == Property::Volume)
+	{
+		return raw(PianoMessage(Action::Info, Property::Volume, index, PianoController::DefaultVolume));
+	}
+	else if (property == Property::Pan)
+	{
+		return raw(PianoMessage(Action::Info, Property::Pan, index, PianoController::PanBase));
+	}
+	else if (property == Property::Octave)
+	{
+		return raw(PianoMessage(Action::Info, Property::Octave, index, PianoController::OctaveBase));
+	}
+	else if (property == Property::Transpose)
+	{
+		return raw(PianoMessage(Action::Info, Property::Transpose, index, PianoController::TransposeBase));
+	}
+	else if (property == Property::Tempo)
+	{
+		return raw(PianoMessage(Action::Info, Property::Tempo, index, PianoController::DefaultTempo));
+	}
+	else if (property == Property::ReverbEffect)
+	{
+		return raw(PianoMessage(Action::Info, Property::ReverbEffect, index, PianoController::DefaultReverbEffect));
+	}
+	else if (property == Property::Active)
+	{
+		const bool active = index != PianoController::chLayer && index != PianoController::chLeft;
+		return raw(PianoMessage(Action::Info, Property::Active, index, active ? 1 : 0));
+	}
+	else if (property == Property::PartAuto)
+	{
+		return raw(PianoMessage(Action::Info, Property::PartAuto, index, 1));
+	}
+	else if (property == Property::VoiceMidi)
+	{
+		return raw(PianoMessage(Action::Info, Property::VoiceMidi, index, 0));
+	}
+
+	// all remaining properties are single byte switches
+	uint8_t data = 0;
+	return MemoryBlock(&data, 1);
+}
+
+void PianoSimulator::Piano::Playback(double now)
+{
+	if (!m_playing || now < m_nextBeat)
+	{
+		return;
+	}
+
+	const int tempo = jmax((int)PianoController::MinTempo, GetIntValue(Property::Tempo, 0));
+	m_nextBeat += 60000.0 / tempo;
+
+	MemoryBlock value = GetValue(Property::Position, 0);
+	MemoryBlock length = GetValue(Property::Length, 0);
+	int measure = ((uint8_t)value[0] << 7) + (uint8_t)value[1];
+	int beat = ((uint8_t)value[2] << 7) + (uint8_t)value[3] + 1;
+	const int lastMeasure = ((uint8_t)length[0] << 7) + (uint8_t)length[1];
+
+	if (beat > 4)
+	{
+		beat = 1;
+		measure++;
+	}
+
+	if (measure > lastMeasure)
+	{
+		measure = 1;
+		beat = 1;
+		m_playing = false;
+		uint8_t stop = 0;
+		SetValue(Property::Play, 0, MemoryBlock(&stop, 1));
+		NotifyValue(Property::Play);
+	}
+
+	value[0] = (char)(measure >> 7);
+	value[1] = (char)(measure & 0x7f);
+	value[2] = (char)(beat >> 7);
+	value[3] = (char)(beat & 0x7f);
+	SetValue(Property::Position, 0, value);
+	NotifyValue(Property::Position);
+}
+
+void PianoSimulator::Piano::PlayNotes(double now)
+{
+	if (m_options.notesPerSecond <= 0 || now < m_nextNote)
+	{
+		return;
+	}
+
+	m_nextNote = jmax(m_nextNote + 1000.0 / m_options.notesPerSecond, now - 1000);
+
+	if (m_lastNote >= 0)
+	{
+		m_session->noteOff(m_lastNote, 0, 1);
+	}
+
+	m_lastNote = 36 + m_random.nextInt(61);
+	m_session->noteOn(m_lastNote, 40 + m_random.nextInt(80), 1);
+
+	const ScopedLock lock(m_statsLock);
+	m_stats.notes++;
+}
+
+void PianoSimulator::Piano::SongUploaded(const String& songName)
+{
+	const ScopedLock lock(m_uploadLock);
+	m_uploadedSongs.add(songName);
+
+	const ScopedLock statsLock(m_statsLock);
+	m_stats.uploads++;
+}
+
+void PianoSimulator::Piano::ProcessUploads()
+{
+	StringArray songs;
+	{
+		const ScopedLock lock(m_uploadLock);
+		songs.swapWith(m_uploadedSongs);
+	}
+
+	for (const String& songName : songs)
+	{
+		m_playing = false;
+
+		// song names are reported as raw bytes, the app decodes them from UTF-8 itself
+		String rawName;
+		const char* utf8 = songName.toRawUTF8();
+		for (size_t i = 0; utf8[i]; i++)
+		{
+			rawName += (juce_wchar)(uint8_t)utf8[i];
+		}
+
+		PianoMessage name(Action::Info, Property::SongName, 0, rawName);
+		SetValue(Property::SongName, 0, MemoryBlock(name.GetRawValue(), (size_t)name.GetSize()));
+
+		uint8_t length[4] = {0, 32, 0, 1};
+		SetValue(Property::Length, 0, MemoryBlock(length, 4));
+		m_values.erase({Property::Position.signature, 0});
+
+		uint8_t present = 1;
+		for (int ch = PianoController::chMidi1; ch <= PianoController::chMidi4; ch++)
+		{
+			SetValue(Property::Present, ch, MemoryBlock(&present, 1));
+			NotifyValue(Property::Present, ch);
+		}
+
+		NotifyValue(Property::SongName);
+		NotifyValue(Property::Length);
+		NotifyValue(Property::Position);
+		NotifyValue(Property::Play);
+	}
+}
+
+bool PianoSimulator::Piano::UploadListener::Start(const String& address)
+{
+	if (!m_listener.createListener(10504, address))
+	{
+		return false;
+	}
+
+	startThread();
+	return true;
+}
+
+void PianoSimulator::Piano::UploadListener::Stop()
+{
+	signalThreadShouldExit();
+	m_listener.close();
+	stopThread(2000);
+}
+
+void PianoSimulator::Piano::UploadListener::run()
+{
+	while (!threadShouldExit())
+	{
+		std::unique_ptr<StreamingSocket> connection(m_listener.waitForNextConnection());
+		if (connection)
+		{
+			ReceiveSong(*connection);
+		}
+	}
+}
+
+void PianoSimulator::Piano::UploadListener::ReceiveSong(StreamingSocket& connection)
+{
+	// see PianoController::UploadSong for message format
+	uint8_t header[24];
+	if (connection.read(header, (int)sizeof(header), true) != (int)sizeof(header))
+	{
+		return;
+	}
+
+	const int payloadSize = (header[8] << 24) + (header[9] << 16) + (header[10] << 8) + header[11];
+	const int nameLength = header[23];
+
+	HeapBlock<char> name(nameLength + 1, true);
+	if (connection.read(name, nameLength, true) != nameLength)
+	{
+		return;
+	}
+
+	// the song content is of no interest, just consume it
+	int remaining = payloadSize + 8 + 4 - (int)sizeof(header) - nameLength;
+	char buf[16 * 1024];
+	while (remaining > 0 && !threadShouldExit())
+	{
+		int received = connection.read(buf, jmin(remaining, (int)sizeof(buf)), true);
+		if (received <= 0)
+		{
+			return;
+		}
+		remaining -= received;
+	}
+
+	char response[16] = {0};
+	connection.write(response, (int)sizeof(response));
+
+	m_piano.SongUploaded(String::fromUTF8(name));
+}
+
+PianoSimulator::~PianoSimulator()
+{
+	Stop();
+}
+
+bool PianoSimulator::Start()
+{
+	StringArray octets = StringArray::fromTokens(m_options.firstAddress, ".", "");
+	if (octets.size() != 4)
+	{
+		Logger::writeToLog("Invalid piano address: " + m_options.firstAddress);
+		return false;
+	}
+
+	for (int i = 0; i < m_options.pianoCount; i++)
+	{
+		String address = octets.joinIntoString(".", 0, 3) + "." + String(octets[3].getIntValue() + i);
+		Piano* piano = new Piano(address, m_options);
+		m_pianos.add(piano);
+
+		if (!piano->Start())
+		{
+			Logger::writeToLog("Could not open ports of simulated piano at " + address);
+			return false;
+		}
+
+		Logger::writeToLog("Simulated piano listening at " + address);
+	}
+
+	if (m_options.statsInterval > 0)
+	{
+		startTimer(m_options.statsInterval * 1000);
+	}
+
+	return true;
+}
+
+void PianoSimulator::Stop()
+{
+	stopTimer();
+
+	if (!m_pianos.isEmpty())
+	{
+		Logger::writeToLog(GetStatistics());
+		m_pianos.clear();
+	}
+}
+
+void PianoSimulator::timerCallback()
+{
+	Logger::writeToLog(GetStatistics());
+}
+
+String PianoSimulator::GetStatistics()
+{
+	String result;
+
+	for (Piano* piano : m_pianos)
+	{
+		Statistics stats = piano->GetStatistics();
+		result << piano->GetAddress() << ": sessions " << stats.sessions <<
+			", connect " << stats.connectTime << " ms" <<
+			", resync " << stats.resyncTime << " ms (" << stats.resyncRequests << " requests)" <<
+			", received " << stats.requests << ", sent " << stats.responses <<
+			", latency " << String(stats.latencyLast, 1) << "/" << String(stats.latencyAvg, 1) <<
+			"/" << String(stats.latencyMax, 1) << " ms (last/avg/max of " << stats.latencyCount << ")" <<
+			", notes " << stats.notes << ", dropped " << stats.dropped <<
+			", uploads " << stats.uploads << newLine;
+	}
+
+	return result.trimEnd();
+}
+
+bool PianoSimulator::ParseCommandLine(const String& commandLine, Options& options)
+{
+	StringArray args = StringArray::fromTokens(commandLine, true);
+
+	if (!args.contains("--simulate-piano"))
+	{
+		return false;
+	}
+
+	for (const String& arg : args)
+	{
+		String value = arg.fromFirstOccurrenceOf("=", false, false);
+
+		if (arg.startsWith("--sim-pianos="))
+		{
+			options.pianoCount = jlimit(1, 254, value.getIntValue());
+		}
+		else if (arg.startsWith("--sim-address="))
+		{
+			options.firstAddress = value;
+		}
+		else if (arg.startsWith("--sim-drop="))
+		{
+			options.impairment.dropRate = value.getFloatValue() / 100;
+		}
+		else if (arg.startsWith("--sim-latency="))
+		{
+			options.impairment.latency = value.getIntValue();
+		}
+		else if (arg.startsWith("--sim-jitter="))
+		{
+			options.impairment.jitter = value.getIntValue();
+		}
+		else if (arg.startsWith("--sim-reorder="))
+		{
+			options.impairment.reorderRate = value.getFloatValue() / 100;
+		}
+		else if (arg.startsWith("--sim-notes="))
+		{
+			options.notesPerSecond = value.getIntValue();
+		}
+		else if (arg.startsWith("--sim-stats="))
+		{
+			options.statsInterval = value.getIntValue();
+		}
+	}
+
+	return true;
+}
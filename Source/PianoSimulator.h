@@ -0,0 +1,82 @@
+/*
+ *  This file is part of ConPianist. See <https://github.com/hugbug/conpianist>.
+ *
+ *  Copyright (C) 2020 Andrey Prygunkov <hugbug@users.sourceforge.net>
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "../JuceLibraryCode/JuceHeader.h"
+
+// Stand-in for a Clavinova piano, used for testing without real hardware.
+// Each simulated piano speaks AppleMIDI (RTP-MIDI) on UDP ports 5004/5005,
+// answers CSP SysEx requests and accepts song uploads on TCP port 10504.
+// Several pianos can run at once, each bound to its own loopback address
+// (127.0.0.1, 127.0.0.2, ...; on macOS extra addresses must be aliased first).
+class PianoSimulator : public Timer
+{
+public:
+	struct Impairment
+	{
+		float dropRate = 0; // probability of an UDP packet to be lost (0..1)
+		int latency = 0; // delay of outgoing UDP packets, milliseconds
+		int jitter = 0; // random extra delay of outgoing UDP packets, milliseconds
+		float reorderRate = 0; // probability of an UDP packet to be overtaken by next packets (0..1)
+	};
+
+	struct Options
+	{
+		int pianoCount = 1;
+		String firstAddress = "127.0.0.1";
+		Impairment impairment;
+		int notesPerSecond = 0; // synthetic performance sent to connected app
+		int statsInterval = 5; // seconds, 0 - print statistics only on exit
+	};
+
+	struct Statistics
+	{
+		int sessions = 0; // number of accepted AppleMIDI invitations
+		int connectTime = 0; // milliseconds from invitation to first CSP request
+		int resyncTime = 0; // milliseconds of last burst of CSP Get-requests
+		int resyncRequests = 0; // number of requests in last burst
+		int requests = 0; // CSP messages received
+		int responses = 0; // CSP messages sent
+		int latencyCount = 0; // responses to requests with measured latency
+		float latencyLast = 0; // milliseconds from receiving a request to sending its response,
+		float latencyAvg = 0; // simulated network delay included
+		float latencyMax = 0;
+		int notes = 0; // note messages sent
+		int dropped = 0; // UDP packets dropped (both directions)
+		int uploads = 0; // songs received on upload port
+	};
+
+	PianoSimulator(const Options& options) : m_options(options) {}
+	~PianoSimulator();
+	bool Start();
+	void Stop();
+	String GetStatistics();
+
+	// Recognizes "--simulate-piano" with optional "--sim-*" settings, see Main.cpp
+	static bool ParseCommandLine(const String& commandLine, Options& options);
+
+	void timerCallback() override;
+
+private:
+	class Piano;
+
+	Options m_options;
+	OwnedArray<Piano> m_pianos;
+};
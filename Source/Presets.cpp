@@ -21,11 +21,15 @@
 
 namespace
 {
-	using U = CharPointer_UTF8;
+	struct VoiceMapping
+	{
+		int num;
+		int target; // -1 for known voices without proper mapping
+	};
 
-	VoiceList voices = {
+	constexpr VoiceDef voiceDefs[] = {
 		{7077888, "PRESET:/VOICE/Piano/Grand Piano/CFX Grand.T542.VRM", "VRM"},
-		{7079424, U("PRESET:/VOICE/Piano/Grand Piano/Bösendorfer.T543.VRM"), "VRM"},
+		{7079424, "PRESET:/VOICE/Piano/Grand Piano/B\xc3\xb6sendorfer.T543.VRM", "VRM"},
 		{7082241, "PRESET:/VOICE/Piano/Grand Piano/Pop Grand.T228.VRM", "VRM"},
 		{7082496, "PRESET:/VOICE/Piano/Grand Piano/Mellow Piano.T228.VRM", "VRM"},
 		{7078146, "PRESET:/VOICE/Piano/Grand Piano/Studio Grand.T228.VRM", "VRM"},
@@ -747,1767 +751,1490 @@ namespace
 		{6815847, "PRESET:/VOICE/Synth/Synth Effects/Pitch Fall.T270.VCE", "Regular"},
 	};
 
-	std::map<int, int> voiceMap = {
-		{7082496, 7082241},
-		{7078146, 7082241},
-		{7079425, 7082241},
-		{7081985, 7082241},
-		{7084803, 7082241},
-		{7081986, 7082241},
-		{7085824, 7082241},
-		{7083521, 7082241},
-		{7083777, 7082241},
-		{7085059, 7082241},
-		{6819328, 6819073},
-		{6819584, 6819073},
-		{6819075, 6819073},
-		{6819329, 6819073},
-		{6819331, 6819073},
-		{6819587, 6819073},
-		{7084548, 7084292},
-		{6816258, 7084292},
-		{6816514, 7084292},
-		{6817792, 7084292},
-		{7086082, 7084292},
-		{7084290, 7084292},
-		{7083776, 7084292},
-		{6818816, 7084292},
-		{29700, 30212},
-		{30468, 30212},
-		{31236, 30212},
-		{29956, 30212},
-		{31492, 30212},
-		{28932, 30212},
-		{31748, 30212},
-		{30469, 30212},
-		{6815748, 30212},
-		{30981, 6818053},
-		{6815749, 6818053},
-		{31749, 6818053},
-		{31493, 6818053},
-		{6816261, 6818053},
-		{29188, 6818053},
-		{31237, 6818053},
-		{6816517, 6818053},
-		{6816005, 6818053},
-		{6816611, 6818053},
-		{6820696, 6818053},
-		{28935, 28679},
-		{29447, 28679},
-		{532592, 31238},
-		{31494, 31238},
-		{28934, 31238},
-		{31750, 31238},
-		{30992, 532509},
-		{532510, 532509},
-		{28432, 532509},
-		{532593, 532509},
-		{32528, 532509},
-		{533021, 532509},
-		{30226, 532509},
-		{532849, 532509},
-		{6815760, 532509},
-		{532765, 532509},
-		{28434, 532509},
-		{29968, 532509},
-		{28433, 532509},
-		{29458, 532509},
-		{27665, 532509},
-		{27409, 532509},
-		{27153, 532509},
-		{26897, 532509},
-		{26641, 532509},
-		{6816017, 532509},
-		{6815761, 532509},
-		{32273, 532509},
-		{32529, 532509},
-		{6816018, 532509},
-		{6815762, 532509},
-		{6816274, 532509},
-		{29970, 532509},
-		{29457, 532509},
-		{27921, 532509},
-		{6824208, 6823952},
-		{6824464, 6823952},
-		{6824720, 6823952},
-		{30224, 6823952},
-		{28947, 31507},
-		{28691, 31507},
-		{29203, 31507},
-		{31251, 31507},
-		{29459, 31507},
-		{32274, 32530},
-		{29443, 32530},
-		{6817297, 32530},
-		{6818064, 32530},
-		{6817808, 32530},
-		{6817041, 32530},
-		{6817553, 32530},
-		{6818320, 32530},
-		{31504, 32530},
-		{31760, 32530},
-		{32017, 32530},
-		{31761, 32530},
-		{655624, 655368},
-		{655880, 655368},
-		{656136, 655368},
-		{656392, 655368},
-		{656648, 655368},
-		{656904, 655368},
-		{657160, 655368},
-		{657416, 655368},
-		{657672, 655368},
-		{655369, 655368},
-		{655625, 655368},
-		{655881, 655368},
-		{656137, 655368},
-		{656393, 655368},
-		{656649, 655368},
-		{656905, 655368},
-		{657161, 655368},
-		{657417, 655368},
-		{657673, 655368},
-		{655370, 655368},
-		{655626, 655368},
-		{655882, 655368},
-		{656138, 655368},
-		{656394, 655368},
-		{656906, 655368},
-		{656650, 655368},
-		{657162, 655368},
-		{657418, 655368},
-		{657674, 655368},
-		{28950, 28694},
-		{29206, 28694},
-		{30485, 6816277},
-		{30229, 6816277},
-		{29973, 6816277},
-		{30741, 6816277},
-		{6815765, 6816277},
-		{6816533, 6816277},
-		{6816021, 6816277},
-		{29207, 28951},
-		{6817045, 6816277},
-		{31509, 6816277},
-		{31253, 6816277},
-		{6817301, 6816277},
-		{30997, 6816277},
-		{29463, 28951},
-		{29720, 532480},
-		{30232, 532736},
-		{532992, 532480},
-		{29464, 532480},
-		{29976, 532480},
-		{30488, 532480},
-		{533248, 532480},
-		{30233, 532481},
-		{532737, 532481},
-		{29721, 532481},
-		{29977, 532481},
-		{30745, 532481},
-		{28953, 532481},
-		{536579, 535811},
-		{536067, 535811},
-		{536323, 535811},
-		{537091, 535811},
-		{6816795, 535811},
-		{534022, 532742},
-		{534278, 532742},
-		{533254, 532742},
-		{538627, 535811},
-		{535043, 535811},
-		{538115, 535811},
-		{537859, 535811},
-		{535555, 535811},
-		{537347, 535811},
-		{532739, 535811},
-		{532483, 535811},
-		{532995, 535811},
-		{533251, 535811},
-		{27675, 535811},
-		{6816026, 532742},
-		{536835, 535811},
-		{534275, 535811},
-		{534019, 535811},
-		{535045, 535811},
-		{31515, 535811},
-		{27419, 535811},
-		{28699, 535811},
-		{532486, 532742},
-		{29980, 535811},
-		{30492, 535811},
-		{28187, 535811},
-		{30236, 535811},
-		{6817563, 535811},
-		{6815772, 535811},
-		{6817051, 535811},
-		{29468, 535811},
-		{6817307, 535811},
-		{6815770, 532742},
-		{29724, 535811},
-		{32283, 535811},
-		{28443, 535811},
-		{27931, 535811},
-		{29466, 532742},
-		{29722, 532742},
-		{28954, 532742},
-		{29212, 535811},
-		{29979, 535811},
-		{533509, 533253},
-		{533765, 533253},
-		{534021, 533253},
-		{533508, 533253},
-		{532484, 533253},
-		{533252, 533253},
-		{534789, 533253},
-		{532996, 534277},
-		{532485, 533253},
-		{534787, 535811},
-		{532740, 533253},
-		{535299, 535811},
-		{532997, 533253},
-		{6817819, 535811},
-		{532741, 533253},
-		{538371, 534277},
-		{6816286, 533253},
-		{533763, 534277},
-		{29981, 533253},
-		{534533, 534277},
-		{30750, 533253},
-		{533507, 537603},
-		{6815759, 6816015},
-		{6816302, 28687},
-		{30234, 537603},
-		{29467, 537603},
-		{532753, 532497},
-		{532752, 532496},
-		{532498, 532497},
-		{6816288, 532496},
-		{6816032, 532496},
-		{6815776, 532496},
-		{6816033, 532497},
-		{6816289, 532497},
-		{29216, 532496},
-		{6816545, 532497},
-		{28964, 532497},
-		{6816034, 532497},
-		{6816290, 532497},
-		{28707, 532499},
-		{28708, 532497},
-		{29218, 532497},
-		{28705, 532497},
-		{28706, 532497},
-		{28962, 532497},
-		{29217, 532497},
-		{29473, 532497},
-		{28963, 532499},
-		{6815778, 532497},
-		{28709, 532497},
-		{6816295, 6815783},
-		{6816039, 6815783},
-		{6816592, 6815783},
-		{6815782, 6815783},
-		{6816550, 6815783},
-		{6816038, 6815783},
-		{6816551, 6815783},
-		{6816294, 6815783},
-		{6816806, 6815783},
-		{6817062, 6815783},
-		{6818086, 6815783},
-		{6817318, 6815783},
-		{6817063, 6815783},
-		{6817574, 6815783},
-		{6818342, 6815783},
-		{6817830, 6815783},
-		{6817319, 6815783},
-		{6816807, 6815783},
-		{6818598, 6815783},
-		{6817575, 6815783},
-		{29734, 6815783},
-		{6820177, 6815783},
-		{30246, 6815783},
-		{29223, 6815783},
-		{29222, 6815783},
-		{28710, 6815783},
-		{29991, 6815783},
-		{28712, 28968},
-		{28782, 28968},
-		{28715, 532496},
-		{533552, 532785},
-		{532529, 532785},
-		{533808, 532785},
-		{28973, 532785},
-		{534832, 532785},
-		{6815788, 532785},
-		{533297, 532785},
-		{6817328, 532785},
-		{532528, 532785},
-		{31536, 532785},
-		{533041, 532785},
-		{31537, 532785},
-		{31793, 532785},
-		{534320, 532785},
-		{28972, 532785},
-		{534576, 532785},
-		{30001, 532785},
-		{534577, 532785},
-		{31281, 532785},
-		{534833, 532785},
-		{31792, 532785},
-		{535089, 532785},
-		{28721, 532785},
-		{6816044, 532785},
-		{533040, 532785},
-		{532784, 532785},
-		{30768, 532785},
-		{6816817, 532785},
-		{30512, 532785},
-		{6817073, 532785},
-		{30256, 532785},
-		{6817329, 532785},
-		{30000, 532785},
-		{6816049, 30769},
-		{6815793, 30769},
-		{29485, 30769},
-		{532531, 532787},
-		{6817844, 532787},
-		{6817845, 532787},
-		{533299, 532787},
-		{533555, 532787},
-		{533043, 532787},
-		{536887, 532787},
-		{28981, 532787},
-		{30260, 29748},
-		{29236, 532787},
-		{30520, 532544},
-		{532800, 532544},
-		{533056, 532544},
-		{533824, 532544},
-		{534080, 532544},
-		{29496, 532544},
-		{533312, 532544},
-		{30776, 532544},
-		{31032, 532544},
-		{6815803, 29243},
-		{31288, 532544},
-		{6815802, 28986},
-		{6815801, 30009},
-		{29242, 28986},
-		{28961, 28986},
-		{532540, 6815804},
-		{533560, 533816},
-		{32573, 533816},
-		{6816060, 6815804},
-		{6816316, 6815804},
-		{31038, 533816},
-		{532796, 6815804},
-		{27965, 533816},
-		{6816572, 6815804},
-		{533048, 533816},
-		{533052, 6815804},
-		{533304, 533816},
-		{27709, 533816},
-		{31544, 533816},
-		{28221, 533816},
-		{30012, 6815804},
-		{28477, 533816},
-		{532536, 533816},
-		{30014, 533816},
-		{534072, 533816},
-		{30270, 533816},
-		{26941, 533816},
-		{30780, 533816},
-		{27453, 533816},
-		{28987, 533816},
-		{27197, 533816},
-		{29758, 533816},
-		{533330, 532562},
-		{533058, 532546},
-		{532818, 532562},
-		{28482, 532562},
-		{32578, 532562},
-		{6815809, 532546},
-		{32322, 532562},
-		{30018, 532562},
-		{32066, 532562},
-		{27714, 533586},
-		{534098, 533586},
-		{27970, 533586},
-		{29762, 533586},
-		{28226, 533586},
-		{533842, 533586},
-		{30530, 533586},
-		{534354, 533586},
-		{31554, 533586},
-		{31298, 533586},
-		{31042, 533586},
-		{29257, 532553},
-		{28996, 532548},
-		{29255, 6815815},
-		{28742, 6815814},
-		{6816327, 6815815},
-		{29513, 532553},
-		{28740, 532548},
-		{28743, 6815815},
-		{6816329, 29511},
-		{6816070, 29511},
-		{6816071, 29511},
-		{6816073, 532553},
-		{6816068, 29511},
-		{29769, 29511},
-		{6816324, 29511},
-		{29001, 29003},
-		{30793, 532553},
-		{28747, 29003},
-		{28939, 6816011},
-		{31755, 6816011},
-		{31243, 6816011},
-		{532747, 6816011},
-		{29195, 6816011},
-		{6815790, 6816046},
-		{28727, 30769},
-		{8323160, 8323159},
-		{8323161, 8323163},
-		{8323162, 8323159},
-		{8323133, 8323132},
-		{8323158, 8323159},
-		{8323130, 8323132},
-		{8323131, 8323132},
-		{8323104, 8323163},
-		{8323129, 8323132},
-		{8323076, 8323159},
-		{8323128, 8323132},
-		{8323080, 8323163},
-		{8323099, 8323132},
-		{8323096, 8323132},
-		{8323097, 8323132},
-		{8323112, 8323113},
-		{8257579, 8257576},
-		{8257539, 8257538},
-		{6815869, 8257538},
-		{8257544, 8257538},
-		{6815870, 8257538},
-		{6816126, 8257538},
-		{6815866, 8257538},
-		{6815871, 8257538},
-		{8257536, 8257538},
-		{8257537, 8257538},
-		{6815824, 6815783},
-		{30801, 6815783},
-		{6819921, 6815783},
-		{30544, 6815783},
-		{6819665, 6815783},
-		{30289, 6815783},
-		{31313, 6815783},
-		{6817104, 6815783},
-		{31569, 6815783},
-		{6816084, 6815783},
-		{6816081, 6815783},
-		{30292, 6815783},
-		{6817086, 6815783},
-		{32593, 6815783},
-		{6817617, 6815783},
-		{29271, 6815783},
-		{6816337, 6815783},
-		{29008, 6815783},
-		{6815825, 6815783},
-		{30032, 6815783},
-		{30036, 6815783},
-		{29521, 6815783},
-		{29780, 6815783},
-		{29524, 6815783},
-		{31824, 6815783},
-		{6815828, 6815783},
-		{29777, 6815783},
-		{6818392, 532600},
-		{6818648, 532600},
-		{6819672, 532600},
-		{6819160, 532600},
-		{6818099, 6816603},
-		{6820440, 6816603},
-		{6818904, 532600},
-		{6819416, 532600},
-		{6819928, 532600},
-		{6816099, 532600},
-		{6820184, 532600},
-		{6815843, 6816355},
-		{6818897, 532600},
-		{6817112, 6816355},
-		{6817368, 6816355},
-		{6815845, 532600},
-		{6815844, 532600},
-		{29283, 6816355},
-		{6817624, 532600},
-		{6816340, 6815783},
-		{6816848, 532600},
-		{6816346, 532600},
-		{6816830, 532600},
-		{6817623, 532600},
-		{6817879, 532600},
-		{6816343, 532600},
-		{6815850, 6816355},
-		{6816599, 532600},
-		{6815841, 6816355},
-		{6817367, 532600},
-		{6816097, 6816355},
-		{6816087, 532600},
-		{6816104, 6816355},
-		{6818641, 532600},
-		{6817880, 532600},
-		{6816849, 532600},
-		{6818136, 532600},
-		{6817361, 532600},
-		{28978, 28722},
-		{6816306, 6816355},
-		{29018, 6816603},
-		{6816307, 6816603},
-		{28979, 28722},
-		{29279, 6816355},
-		{6816051, 28722},
-		{6816818, 6816603},
-		{6816562, 6816603},
-		{6815794, 6816603},
-		{6816607, 6816355},
-		{6815795, 6816603},
-		{6816602, 6816603},
-		{6816050, 28722},
-		{6820945, 28735},
-		{29759, 28735},
-		{28990, 28735},
-		{6815806, 28735},
-		{29502, 28735},
-		{6816062, 28735},
-		{29246, 28735},
-		{28991, 28735},
-		{29503, 28735},
-		{6816318, 28735},
-		{30782, 28735},
-		{6817342, 28735},
-		{29247, 28735},
-		{6817381, 6816355},
-		{6815836, 6816355},
-		{6817637, 6816603},
-		{6816859, 6816355},
-		{6817118, 6816603},
-		{6816613, 6816603},
-		{6821464, 6816355},
-		{6817369, 6816603},
-		{6816863, 6816355},
-		{6817375, 6816603},
-		{28773, 6816355},
-		{6816094, 6816355},
-		{6816101, 6816603},
-		{6816857, 6816603},
-		{6816600, 6816355},
-		{6815833, 6816603},
-		{6816856, 6816603},
-		{6816351, 6816603},
-		{6815838, 6816355},
-		{6816345, 6816603},
-		{6816089, 6816603},
-		{6816601, 6816603},
-		{6816095, 6816355},
-		{6815832, 6816355},
-		{6816344, 6816603},
-		{6817114, 6816603},
-		{6815835, 6816603},
-		{6815837, 6816603},
-		{6816088, 6816355},
-		{30553, 6816603},
-		{30809, 6816603},
-		{30559, 6816603},
-		{31065, 6816355},
-		{29530, 6816603},
-		{31321, 6816603},
-		{29528, 6816603},
-		{28762, 6816603},
-		{29278, 6816603},
-		{29274, 6816603},
-		{29022, 6816603},
-		{29535, 6816603},
-		{29529, 6816603},
-		{29784, 6816355},
-		{29027, 6816603},
-		{29029, 6816355},
-		{29023, 6816603},
-		{30047, 6816603},
-		{30303, 6816603},
-		{6816563, 6816355},
-		{6815834, 32336},
-		{6816858, 6816603},
-		{6817873, 32336},
-		{6817331, 6816603},
-		{6818129, 32336},
-		{6815839, 6816603},
-		{6816593, 32336},
-		{6816574, 32336},
-		{6815831, 32336},
-		{6817105, 532600},
-		{6818385, 32336},
-		{6819153, 532600},
-		{6816819, 6816355},
-		{6817587, 28735},
-		{6819409, 32336},
-		{6816855, 532600},
-		{6817111, 532600},
-		{6816090, 532600},
-		{6817075, 32336},
-		{28758, 32336},
-		{31056, 6816603},
-		{29014, 32336},
-		{6816869, 6816355},
-		{6816862, 6816355},
-		{6817125, 6816355},
-		{6817893, 6816355},
-		{6817113, 6816355},
-		{6820952, 6816355},
-		{6816350, 6816355},
-		{6821208, 6816355},
-		{6816606, 6816355},
-		{6818149, 6816355},
-		{6817374, 6816355},
-		{6818405, 6816355},
-		{6818661, 6816355},
-		{6816353, 6816355},
-		{6816357, 6816355},
-		{6818135, 532600},
-		{6815847, 532600},
-		{6818304, 7082241},
-		{29440, 7082241},
-		{28928, 7082241},
-		{6816768, 7082241},
-		{6817024, 7082241},
-		{6818560, 7082241},
-		{29184, 7082241},
-		{28673, 7082241},
-		{6816512, 7082241},
-		{6815747, 7082241},
-		{31235, 7082241},
-		{28675, 6819073},
-		{6816259, 7082241},
-		{6816515, 7082241},
-		{28931, 7082241},
-		{29187, 7082241},
-		{6816256, 7084292},
-		{28674, 7084292},
-		{28678, 31238},
-		{29186, 30212},
-		{30725, 30212},
-		{28676, 30212},
-		{28933, 30212},
-		{30213, 30212},
-		{29445, 30212},
-		{29701, 30212},
-		{30724, 30212},
-		{28677, 6818053},
-		{29444, 6818053},
-		{29957, 6818053},
-		{29189, 6818053},
-		{29191, 28679},
-		{29712, 532509},
-		{28689, 532509},
-		{28945, 532509},
-		{30737, 532509},
-		{29456, 532509},
-		{30225, 532509},
-		{6816530, 532509},
-		{30480, 532509},
-		{28688, 532509},
-		{28944, 532509},
-		{30736, 532509},
-		{30481, 532509},
-		{29202, 532509},
-		{28690, 532509},
-		{30482, 532509},
-		{28946, 532509},
-		{29714, 532509},
-		{28177, 532509},
-		{29713, 6823952},
-		{28692, 32530},
-		{31248, 32530},
-		{29200, 32530},
-		{29201, 32530},
-		{31249, 32530},
-		{31505, 32530},
-		{32016, 32530},
-		{32272, 655368},
-		{28697, 532481},
-		{29465, 532481},
-		{30489, 532481},
-		{6816027, 535811},
-		{29723, 535811},
-		{31771, 535811},
-		{6816539, 535811},
-		{29211, 535811},
-		{30491, 535811},
-		{28956, 535811},
-		{28700, 535811},
-		{6815771, 535811},
-		{31003, 535811},
-		{30235, 535811},
-		{28955, 535811},
-		{534531, 535811},
-		{6816283, 535811},
-		{29978, 532742},
-		{28958, 533253},
-		{28702, 533253},
-		{6815774, 533253},
-		{6816030, 533253},
-		{29214, 533253},
-		{29213, 533253},
-		{29982, 533253},
-		{29470, 533253},
-		{29725, 533253},
-		{28957, 534277},
-		{6815773, 534277},
-		{28701, 534277},
-		{30490, 534277},
-		{29469, 534277},
-		{32027, 534277},
-		{30747, 534277},
-		{29726, 534277},
-		{31259, 534277},
-		{28704, 532496},
-		{29479, 6815783},
-		{28711, 6815783},
-		{29478, 6815783},
-		{29735, 6815783},
-		{28965, 6815783},
-		{28966, 6815783},
-		{29990, 6815783},
-		{29717, 6816277},
-		{28695, 6816277},
-		{28693, 6816277},
-		{29461, 6816277},
-		{29205, 6816277},
-		{28949, 6816277},
-		{29744, 532785},
-		{29488, 532785},
-		{29489, 532785},
-		{28976, 532785},
-		{29745, 532785},
-		{28717, 532785},
-		{28977, 532785},
-		{31024, 532785},
-		{28720, 532785},
-		{29232, 532785},
-		{28716, 532785},
-		{30513, 30769},
-		{31025, 30769},
-		{29233, 532785},
-		{30257, 30769},
-		{28723, 28722},
-		{28718, 6816046},
-		{28974, 28687},
-		{28777, 6815849},
-		{28776, 6815848},
-		{28728, 532544},
-		{29752, 532544},
-		{28731, 29243},
-		{28984, 30264},
-		{28729, 30009},
-		{29753, 30009},
-		{29497, 30009},
-		{29241, 30009},
-		{30265, 30009},
-		{28730, 28986},
-		{28989, 533816},
-		{31037, 533816},
-		{29506, 533816},
-		{32317, 533816},
-		{28733, 533816},
-		{29756, 533816},
-		{30781, 533816},
-		{29245, 533816},
-		{29501, 533816},
-		{29757, 533816},
-		{31805, 533816},
-		{32061, 533816},
-		{30013, 533816},
-		{31549, 533816},
-		{30524, 533816},
-		{31293, 533816},
-		{28732, 6815804},
-		{30525, 6815804},
-		{29500, 6815804},
-		{28985, 30268},
-		{30526, 28735},
-		{28988, 28735},
-		{29244, 28735},
-		{30269, 28735},
-		{28734, 28735},
-		{28736, 28992},
-		{29249, 532546},
-		{28737, 532546},
-		{6815810, 532562},
-		{28738, 532562},
-		{30274, 532562},
-		{28739, 6815811},
-		{6815817, 532553},
-		{6815812, 532548},
-		{28745, 532553},
-		{31810, 533586},
-		{30786, 533586},
-		{28994, 29511},
-		{28726, 532787},
-		{28724, 532787},
-		{29492, 532787},
-		{28982, 532787},
-		{28725, 28750},
-		{30552, 532600},
-		{31064, 532600},
-		{30296, 532600},
-		{29790, 6816603},
-		{30808, 6816603},
-		{31320, 6816603},
-		{31576, 6816603},
-		{28685, 6815757},
-		{28684, 6815756},
-		{28683, 6816011},
-		{28681, 6815753},
-		{8323072, 8323163},
-		{8323073, 8323163},
-		{8323088, 8323159},
-		{8257571, 8257603},
-		{29282, 6816355},
-		{28761, 6816603},
-		{28771, 6816355},
-		{29017, 6816603},
-		{29533, 6816355},
-		{29785, 6816355},
-		{29273, 6816603},
-		{28764, 6818053},
-		{28766, 6816603},
-		{30053, 6816355},
-		{28760, 6816603},
-		{28769, 6816355},
-		{29277, 6816603},
-		{29534, 6816603},
-		{29791, 6816603},
-		{30040, 6816355},
-		{29025, 6816355},
-		{30309, 6816603},
-		{29541, 6816355},
-		{29285, 6816603},
-		{29272, 532600},
-		{29016, 6816355},
-		{29797, 6816355},
-		{28767, 6816603},
-		{28763, 6816603},
-		{29012, 6815783},
-		{28755, 6815783},
-		{32337, 6815783},
-		{29009, 6815783},
-		{30297, 6816355},
-		{29265, 32336},
-		{32080, 6815783},
-		{32088, 532600},
-		{30545, 6815783},
-		{31057, 32336},
-		{29776, 6815783},
-		{29015, 6815783},
-		{30041, 532600},
-		{29264, 6815783},
-		{32344, 532600},
-		{31312, 532600},
-		{29268, 32336},
-		{31568, 532600},
-		{30800, 532600},
-		{28756, -1},
-		{29011, 532600},
-		{31825, 32336},
-		{28753, 6815783},
-		{28752, 6815783},
-		{28770, 532600},
-		{31832, 532600},
-		{29026, 532600},
-		{30288, 6815783},
-		{32081, 6815783},
-		{28759, 32336},
-		{29520, 6815783},
-		{30033, 6815783},
-		{524288, 532480},
-		{524289, 532481},
-		{524546, 532481},
-		{524290, 532481},
-		{525315, 535811},
-		{525571, 535811},
-		{525827, 535811},
-		{526083, 535811},
-		{526339, 535811},
-		{525059, 535811},
-		{524547, 535811},
-		{524803, 535811},
-		{524291, 535811},
-		{524294, 532742},
-		{524292, 534277},
-		{524293, 533253},
-		{524561, 532497},
-		{524817, 532497},
-		{524562, 532497},
-		{524305, 532497},
-		{524306, 532497},
-		{524304, 532496},
-		{524307, 532499},
-		{524592, 532785},
-		{524593, 532785},
-		{524337, 532785},
-		{524336, 532785},
-		{524352, 532544},
-		{524344, 533816},
-		{524370, 532562},
-		{32000, 7084292},
-		{6816772, 7084292},
-		{6817028, 7084292},
-		{6817026, 7084292},
-		{31234, 7084292},
-		{6816002, 7084292},
-		{6816000, 7084292},
-		{6815746, 7084292},
-		{6823961, 532481},
-		{30993, 655368},
-		{28176, 655368},
-		{27920, 655368},
-		{27664, 655368},
-		{27408, 655368},
-		{27152, 655368},
-		{29969, 655368},
-		{28178, 655368},
-		{26896, 655368},
-		{26640, 655368},
-		{6816016, 655368},
-		{6816272, 655368},
-		{6816273, 655368},
-		{6816529, 655368},
-		{6816528, 655368},
-		{6816784, 655368},
-		{6817040, 655368},
-		{6816785, 655368},
-		{6817296, 655368},
-		{6817552, 655368},
-		{6818321, 655368},
-		{6818577, 655368},
-		{6818832, 655368},
-		{6820624, 655368},
-		{6821392, 655368},
-		{6819089, 655368},
-		{6822160, 655368},
-		{6822928, 655368},
-		{6823184, 655368},
-		{6823440, 655368},
-		{0, 7082241},
-		{256, 7082241},
-		{4608, 7082241},
-		{10240, 7084292},
-		{10496, 7084292},
-		{1, 7082241},
-		{257, 7082241},
-		{2, 28930},
-		{258, 28930},
-		{8194, 28930},
-		{10242, 28930},
-		{10498, 28930},
-		{3, 6819073},
-		{259, 6819073},
-		{4, 30212},
-		{260, 30212},
-		{4612, 30212},
-		{8196, 30212},
-		{10244, 30212},
-		{11524, 30212},
-		{16388, 30212},
-		{5, 6818053},
-		{261, 6818053},
-		{8197, 6818053},
-		{8453, 6818053},
-		{8709, 6818053},
-		{10245, 6818053},
-		{10501, 6818053},
-		{10757, 6818053},
-		{11525, 6818053},
-		{6, 31238},
-		{262, 31238},
-		{6406, 31238},
-		{8966, 31238},
-		{7, 28679},
-		{263, 28679},
-		{6919, 28679},
-		{16391, 28679},
-		{16647, 28679},
-		{8, 28680},
-		{9, 6815753},
-		{10, 28682},
-		{16394, 28682},
-		{11, 6816011},
-		{267, 6816011},
-		{11531, 6816011},
-		{12, 6815756},
-		{268, 6815756},
-		{16396, 6815756},
-		{24844, -1},
-		{25100, -1},
-		{13, 6815757},
-		{14, 28686},
-		{24590, -1},
-		{24846, -1},
-		{15, 28687},
-		{8975, 28687},
-		{24591, -1},
-		{24847, -1},
-		{16, 655368},
-		{8208, 655368},
-		{8464, 655368},
-		{8720, 655368},
-		{8976, 655368},
-		{9232, 655368},
-		{9488, 655368},
-		{9744, 655368},
-		{10256, 655368},
-		{16400, 655368},
-		{16656, 655368},
-		{16912, 655368},
-		{17168, 655368},
-		{17, 655368},
-		{6161, 655368},
-		{8209, 655368},
-		{8465, 655368},
-		{9489, 655368},
-		{18, 532509},
-		{16402, 532509},
-		{16658, 532509},
-		{16914, 532509},
-		{19, 31507},
-		{8211, 31507},
-		{8979, 31507},
-		{10259, 31507},
-		{16403, 31507},
-		{16659, 31507},
-		{20, 32530},
-		{10260, 32530},
-		{21, 6816277},
-		{8213, 6816277},
-		{22, 28694},
-		{8214, 28694},
-		{23, 28951},
-		{16407, 28951},
-		{24, 532480},
-		{4120, 532480},
-		{6424, 532480},
-		{11032, 532480},
-		{24600, -1},
-		{25, 532481},
-		{4121, 532481},
-		{8985, 532481},
-		{10265, 532481},
-		{10521, 532481},
-		{24601, 29209},
-		{26, 532742},
-		{4634, 532742},
-		{8218, 532742},
-		{27, 535811},
-		{8219, 535811},
-		{28, 535811},
-		{10268, 535811},
-		{10524, 535811},
-		{11036, 535811},
-		{11548, 532742},
-		{29, 534277},
-		{11037, 534277},
-		{30, 533253},
-		{10270, 534277},
-		{10526, 534277},
-		{31, 534277},
-		{16671, 534277},
-		{16927, 534277},
-		{32, 532496},
-		{10272, 532496},
-		{11552, 532496},
-		{33, 532497},
-		{4641, 532497},
-		{6945, 532497},
-		{10273, 532497},
-		{11041, 532497},
-		{11553, 532497},
-		{16673, 532497},
-		{34, 532497},
-		{7202, 532497},
-		{35, 532499},
-		{8227, 532499},
-		{8483, 532499},
-		{8739, 532499},
-		{24611, 532499},
-		{24867, 532499},
-		{36, 532497},
-		{6948, 532497},
-		{8228, 532497},
-		{37, 532497},
-		{11045, 532497},
-		{38, 6815783},
-		{4646, 6815783},
-		{5158, 6815783},
-		{6182, 6815783},
-		{8998, 6815783},
-		{10278, 6815783},
-		{16422, 6815783},
-		{16678, 6815783},
-		{16934, 6815783},
-		{24614, 6815783},
-		{39, 6815783},
-		{1575, 6815783},
-		{3111, 6815783},
-		{4647, 6815783},
-		{4903, 6815783},
-		{8231, 6815783},
-		{10279, 6815783},
-		{10535, 6815783},
-		{16423, 6815783},
-		{40, 28968},
-		{2088, 28968},
-		{41, 28713},
-		{42, 28714},
-		{43, 532496},
-		{44, 532785},
-		{2092, 532785},
-		{10284, 532785},
-		{45, 532785},
-		{46, 6816046},
-		{10286, -1},
-		{47, 28719},
-		{48, 532785},
-		{816, 532785},
-		{2096, 532785},
-		{6192, 532785},
-		{9008, 532785},
-		{10288, 532785},
-		{10544, 532785},
-		{10800, 532785},
-		{11568, 532785},
-		{49, 532785},
-		{817, 532785},
-		{2097, 532785},
-		{10289, 532785},
-		{10545, 532785},
-		{16433, 532785},
-		{16689, 532785},
-		{50, 28722},
-		{6962, 28722},
-		{16434, 28722},
-		{16690, 28722},
-		{51, 28722},
-		{52, 532787},
-		{820, 532787},
-		{4148, 532787},
-		{8244, 532787},
-		{10292, 30004},
-		{53, 532787},
-		{54, 6816603},
-		{10294, 6816603},
-		{10550, 6816603},
-		{16438, 6816355},
-		{55, 30769},
-		{9015, 30769},
-		{16439, 30769},
-		{56, 532544},
-		{4152, 532544},
-		{4408, 532544},
-		{8248, 532544},
-		{57, 30009},
-		{4665, 30009},
-		{58, 28986},
-		{4154, 28986},
-		{59, 29243},
-		{60, 6815804},
-		{1596, 6815804},
-		{8252, 6815804},
-		{9532, 6815804},
-		{61, 533816},
-		{9021, 533816},
-		{10301, 533816},
-		{10557, 28735},
-		{10813, 28735},
-		{62, 28735},
-		{3134, 28735},
-		{5182, 28735},
-		{6206, 28735},
-		{6974, 28735},
-		{8254, 28735},
-		{11582, 28735},
-		{16446, 28735},
-		{63, 28735},
-		{4671, 28735},
-		{10303, 28735},
-		{10559, 28735},
-		{11583, 28735},
-		{16447, 28735},
-		{64, 28992},
-		{65, 532546},
-		{10305, 533586},
-		{11073, 532546},
-		{66, 532562},
-		{10306, 532562},
-		{10562, 532562},
-		{16450, 532562},
-		{67, 6815811},
-		{68, 532548},
-		{69, 28741},
-		{70, 6815814},
-		{71, 6815815},
-		{72, 28744},
-		{73, 532553},
-		{74, 28746},
-		{75, 29003},
-		{76, 29003},
-		{77, 28749},
-		{78, -1},
-		{79, 28751},
-		{80, 6815783},
-		{1616, 6815783},
-		{2128, 6815783},
-		{4688, 6815783},
-		{4944, 6815783},
-		{16464, 6815783},
-		{16720, 6815783},
-		{16976, 6815783},
-		{81, 6815783},
-		{1617, 6815783},
-		{2129, 6815783},
-		{4689, 6815783},
-		{4945, 6815783},
-		{5201, 6815783},
-		{6225, 6815783},
-		{6481, 6815783},
-		{10321, 6815783},
-		{10577, 6815783},
-		{11601, 6815783},
-		{24657, 532600},
-		{82, 6815783},
-		{16722, 6815783},
-		{83, 6815783},
-		{16467, 6815783},
-		{84, 6815783},
-		{16468, 6815783},
-		{16724, 6815783},
-		{85, 6815783},
-		{6229, 6815783},
-		{16469, 6815783},
-		{86, 6815783},
-		{9046, 6815783},
-		{87, 6815783},
-		{4183, 6815783},
-		{16471, 6815783},
-		{16727, 6815783},
-		{88, 532600},
-		{16472, 532600},
-		{89, 6816603},
-		{4185, 6816603},
-		{4441, 6816603},
-		{4697, 6816603},
-		{16473, 6816603},
-		{16729, 6816603},
-		{90, 6816603},
-		{16474, 6816603},
-		{16730, 6816603},
-		{16986, 6816603},
-		{17242, 6816603},
-		{91, 6816603},
-		{16475, 6816603},
-		{16987, 6816355},
-		{17243, 6816355},
-		{92, 6816355},
-		{16476, 6816355},
-		{16732, 6816355},
-		{93, 6816355},
-		{16477, 6816355},
-		{16733, 6816355},
-		{94, 6816355},
-		{95, 6816603},
-		{5215, 6816603},
-		{7007, 6816603},
-		{16479, 6816603},
-		{16991, 6816603},
-		{96, 6816355},
-		{11616, 6816355},
-		{16480, 6816355},
-		{16736, 532600},
-		{16992, 532600},
-		{97, 6816355},
-		{7009, 6816355},
-		{16481, 6816355},
-		{98, 532600},
-		{3170, 532600},
-		{3682, 532600},
-		{4706, 532600},
-		{9058, 532600},
-		{10338, 532600},
-		{10594, 532600},
-		{10850, 532600},
-		{16482, 532600},
-		{16738, 532600},
-		{16994, 532600},
-		{17250, 532600},
-		{17506, 532600},
-		{17762, 532600},
-		{18018, 532600},
-		{18274, 532600},
-		{18530, 532600},
-		{99, 532600},
-		{4707, 532600},
-		{4963, 532600},
-		{10339, 532600},
-		{16483, 532600},
-		{16739, 532600},
-		{16995, 532600},
-		{17251, 532600},
-		{100, 532600},
-		{16484, 532600},
-		{24676, 532600},
-		{101, 6816603},
-		{16485, 6816603},
-		{16741, 6816603},
-		{16997, 532600},
-		{17253, 6816603},
-		{17509, 6816603},
-		{18021, 6816355},
-		{18277, 6816355},
-		{24677, 6816355},
-		{102, 6816355},
-		{2150, 6816355},
-		{3686, 6816355},
-		{16486, 6816355},
-		{16742, 6816355},
-		{16998, 6816355},
-		{17254, 6816355},
-		{17510, 6816355},
-		{17766, 6816355},
-		{103, 6816355},
-		{16487, 6816355},
-		{104, 6815848},
-		{8296, 6815848},
-		{9064, 6815848},
-		{24680, -1},
-		{24936, -1},
-		{105, 6815849},
-		{7273, 6815849},
-		{24681, -1},
-		{24937, -1},
-		{25193, -1},
-		{106, 28778},
-		{107, 28779},
-		{24683, -1},
-		{24939, -1},
-		{108, 28780},
-		{109, -1},
-		{110, 28968},
-		{111, -1},
-		{16495, -1},
-		{24687, -1},
-		{24943, -1},
-		{112, -1},
-		{24688, -1},
-		{24944, -1},
-		{25200, -1},
-		{25456, -1},
-		{25712, -1},
-		{25968, -1},
-		{113, -1},
-		{114, 28786},
-		{24946, -1},
-		{25202, -1},
-		{115, -1},
-		{24691, -1},
-		{116, -1},
-		{24692, -1},
-		{117, -1},
-		{16501, -1},
-		{16757, -1},
-		{17013, -1},
-		{118, 8323132},
-		{16502, 8323132},
-		{16758, 8323132},
-		{119, -1},
-		{120, 8257538},
-		{121, 8257538},
-		{122, 8257538},
-		{123, 8257538},
-		{124, 8257538},
-		{125, 8257538},
-		{126, 8257538},
-		{127, 8257538},
-		{4194304, 8257538},
-		{4194305, 8257538},
-		{4194307, 8257538},
-		{4194320, 8257538},
-		{4194336, 8257538},
-		{4194337, 8257538},
-		{4194338, 8257538},
-		{4194339, 8257538},
-		{4194340, 8257538},
-		{4194341, 8257538},
-		{4194352, 8257538},
-		{4194353, 8257538},
-		{4194354, 8257538},
-		{4194358, 8257538},
-		{4194359, 8257538},
-		{4194368, 8257538},
-		{4194369, 8257538},
-		{4194370, 8257538},
-		{4194371, 8257538},
-		{4194372, 8257538},
-		{4194373, 8257538},
-		{4194374, 8257538},
-		{4194384, 8257538},
-		{4194385, 8257538},
-		{4194386, 8257538},
-		{4194387, 8257538},
-		{4194388, 8257538},
-		{4194389, 8257538},
-		{4194390, 8257538},
-		{4194391, 8257538},
-		{4194392, 8257538},
-		{4194393, 8257538},
-		{4194394, 8257538},
-		{4194400, 8257538},
-		{4194401, 8257538},
-		{4194402, 8257538},
-		{4194403, 8257538},
-		{4194404, 8257538},
-		{4194416, 8257538},
-		{4194417, 8257538},
-		{4194418, 8257538},
-		{4194419, 8257538},
-		{7929856, 7082241},
-		{7930112, 7082241},
-		{7930368, 7082241},
-		{7929857, 7082241},
-		{7930113, 7082241},
-		{7929858, 28930},
-		{7930114, 28930},
-		{7929859, 6819073},
-		{7930115, 6819073},
-		{7929860, 30212},
-		{7930116, 30212},
-		{7930372, 30212},
-		{7930628, 30212},
-		{7929861, 6818053},
-		{7930117, 6818053},
-		{7930373, 6818053},
-		{7930629, 6818053},
-		{7930885, 6818053},
-		{7929862, 31238},
-		{7930118, 31238},
-		{7930374, 31238},
-		{7930630, 31238},
-		{7929863, 28679},
-		{7930119, 28679},
-		{7929864, 28680},
-		{7929865, 6815753},
-		{7929866, 28682},
-		{7929867, 6816011},
-		{7930123, 6816011},
-		{7929868, 6815756},
-		{7930124, 6815756},
-		{7929869, 6815757},
-		{7929870, 28686},
-		{7930126, -1},
-		{7930382, -1},
-		{7929871, 28687},
-		{7929872, 655368},
-		{7930128, 655368},
-		{7930384, 655368},
-		{7930640, 655368},
-		{7929873, 655368},
-		{7930129, 655368},
-		{7930385, 655368},
-		{7929874, 532509},
-		{7929875, 31507},
-		{7930131, 31507},
-		{7930387, 31507},
-		{7929876, -1},
-		{7930132, -1},
-		{7929877, 6816277},
-		{7930133, 6816277},
-		{7929878, 28694},
-		{7929879, 28951},
-		{7929880, 532480},
-		{7930136, -1},
-		{7930392, 532480},
-		{7930648, 532480},
-		{7929881, 532481},
-		{7930137, 532481},
-		{7930393, 29209},
-		{7930649, 532481},
-		{7929882, 532742},
-		{7930138, 537603},
-		{7929883, 535811},
-		{7930139, 535811},
-		{7930395, 535811},
-		{7929884, 535811},
-		{7930140, 535811},
-		{7930396, 535811},
-		{7930652, 532742},
-		{7929885, 534277},
-		{7930141, 534277},
-		{7929886, 533253},
-		{7930142, 533253},
-		{7930398, 533253},
-		{7929887, 533253},
-		{7930143, 533253},
-		{7929888, 532496},
-		{7929889, 532497},
-		{7930145, 532497},
-		{7929890, 532497},
-		{7929891, 532499},
-		{7929892, 532497},
-		{7929893, 532497},
-		{7929894, 6815783},
-		{7930150, 6815783},
-		{7930406, 6815783},
-		{7930662, 6815783},
-		{7930918, 6815783},
-		{7929895, 6815783},
-		{7930151, 6815783},
-		{7930407, 6815783},
-		{7930663, 6815783},
-		{7929896, 28968},
-		{7930152, 28968},
-		{7929897, 28713},
-		{7929898, 28714},
-		{7929899, 532496},
-		{7929900, 532785},
-		{7929901, 532785},
-		{7929902, 6816046},
-		{7930158, -1},
-		{7929903, 28719},
-		{7929904, 532785},
-		{7930160, 532785},
-		{7930416, 532785},
-		{7929905, 532785},
-		{7929906, 28722},
-		{7930162, 28722},
-		{7929907, 28722},
-		{7929908, 532787},
-		{7930164, 532787},
-		{7929909, 532787},
-		{7930165, 532787},
-		{7929910, 6816355},
-		{7930166, 6816355},
-		{7929911, 30769},
-		{7930167, 532785},
-		{7930423, 532785},
-		{7930679, 532785},
-		{7929912, 532544},
-		{7930168, 532544},
-		{7929913, 30009},
-		{7930169, 30009},
-		{7930425, 30009},
-		{7929914, 28986},
-		{7929915, 29243},
-		{7930171, 29243},
-		{7929916, 6815804},
-		{7930172, 6815804},
-		{7929917, 533816},
-		{7930173, 533816},
-		{7929918, 28735},
-		{7930174, 28735},
-		{7930430, 28735},
-		{7930686, 28735},
-		{7929919, 28735},
-		{7930175, 28735},
-		{7930431, 28735},
-		{7929920, 28992},
-		{7929921, 532546},
-		{7929922, 532562},
-		{7929923, 6815811},
-		{7929924, 532548},
-		{7929925, 28741},
-		{7929926, 6815814},
-		{7929927, 6815815},
-		{7929928, 28744},
-		{7929929, 532553},
-		{7929930, 28746},
-		{7929931, 29003},
-		{7929932, 29003},
-		{7929933, 28749},
-		{7929934, -1},
-		{7929935, 28751},
-		{7929936, 6815783},
-		{7930192, 6815783},
-		{7930448, 6816355},
-		{7929937, 6815783},
-		{7930193, 6815783},
-		{7930449, 6815783},
-		{7930705, 6815783},
-		{7930961, 532600},
-		{7929938, 6815783},
-		{7929939, 6815783},
-		{7929940, 6815783},
-		{7930196, 6815783},
-		{7929941, 6815783},
-		{7929942, 6815783},
-		{7929943, 6815783},
-		{7930199, 6815783},
-		{7929944, 532600},
-		{7929945, 6816603},
-		{7930201, 6816603},
-		{7929946, 6816603},
-		{7929947, 6816603},
-		{7930203, 6816603},
-		{7929948, 6816603},
-		{7929949, 6816603},
-		{7929950, 6816603},
-		{7929951, 6816603},
-		{7929952, 8257538},
-		{7929953, 6816355},
-		{7929954, 6816355},
-		{7930210, 532600},
-		{7929955, 6816355},
-		{7929956, 6816355},
-		{7929957, 6816355},
-		{7929958, 532600},
-		{7930214, 532600},
-		{7930470, 532600},
-		{7929959, 532600},
-		{7929960, 6815848},
-		{7930216, 6815848},
-		{7929961, 6815849},
-		{7929962, 28778},
-		{7929963, 28779},
-		{7930219, -1},
-		{7929964, 28780},
-		{7929965, -1},
-		{7929966, 28968},
-		{7929967, -1},
-		{7929968, -1},
-		{7929969, -1},
-		{7929970, 28786},
-		{7929971, -1},
-		{7930227, -1},
-		{7929972, -1},
-		{7930228, -1},
-		{7929973, -1},
-		{7930229, -1},
-		{7929974, 8323132},
-		{7930230, 8323132},
-		{7930486, 8323132},
-		{7929975, -1},
-		{7929976, 8257538},
-		{7930232, 8257538},
-		{7930488, 8257538},
-		{7929977, 8257538},
-		{7930233, 8257538},
-		{7929978, 8257538},
-		{7930234, 8257538},
-		{7930490, 8257538},
-		{7930746, 8257538},
-		{7931002, 8257538},
-		{7931258, 8257538},
-		{7929979, 8257538},
-		{7930235, 8257538},
-		{7930491, 8257538},
-		{7930747, 8257538},
-		{7929980, 8257538},
-		{7930236, 8257538},
-		{7930492, 8257538},
-		{7930748, 8257538},
-		{7931004, 8257538},
-		{7931260, 8257538},
-		{7929981, 8257538},
-		{7930237, 8257538},
-		{7930493, 8257538},
-		{7930749, 8257538},
-		{7931005, 8257538},
-		{7931261, 8257538},
-		{7931517, 8257538},
-		{7931773, 8257538},
-		{7932029, 8257538},
-		{7932285, 8257538},
-		{7929982, 8257538},
-		{7930238, 8257538},
-		{7930494, 8257538},
-		{7930750, 8257538},
-		{7931006, 8257538},
-		{7931262, 8257538},
-		{7929983, 8257538},
-		{7930239, 8257538},
-		{7930495, 8257538},
-		{7930751, 8257538},
-		{7864320, 8323163},
-		{7864328, 8323163},
-		{7864336, 8323159},
-		{7864344, 8323159},
-		{7864345, 8323132},
-		{7864352, 8323113},
-		{7864360, 8323113},
-		{7864368, 8323120},
-		{7864376, 8257538},
+	// sorted by voice number for binary search
+	constexpr VoiceMapping voiceMap[] = {
+		{0, 7082241},
+		{1, 7082241},
+		{2, 28930},
+		{3, 6819073},
+		{4, 30212},
+		{5, 6818053},
+		{6, 31238},
+		{7, 28679},
+		{8, 28680},
+		{9, 6815753},
+		{10, 28682},
+		{11, 6816011},
+		{12, 6815756},
+		{13, 6815757},
+		{14, 28686},
+		{15, 28687},
+		{16, 655368},
+		{17, 655368},
+		{18, 532509},
+		{19, 31507},
+		{20, 32530},
+		{21, 6816277},
+		{22, 28694},
+		{23, 28951},
+		{24, 532480},
+		{25, 532481},
+		{26, 532742},
+		{27, 535811},
+		{28, 535811},
+		{29, 534277},
+		{30, 533253},
+		{31, 534277},
+		{32, 532496},
+		{33, 532497},
+		{34, 532497},
+		{35, 532499},
+		{36, 532497},
+		{37, 532497},
+		{38, 6815783},
+		{39, 6815783},
+		{40, 28968},
+		{41, 28713},
+		{42, 28714},
+		{43, 532496},
+		{44, 532785},
+		{45, 532785},
+		{46, 6816046},
+		{47, 28719},
+		{48, 532785},
+		{49, 532785},
+		{50, 28722},
+		{51, 28722},
+		{52, 532787},
+		{53, 532787},
+		{54, 6816603},
+		{55, 30769},
+		{56, 532544},
+		{57, 30009},
+		{58, 28986},
+		{59, 29243},
+		{60, 6815804},
+		{61, 533816},
+		{62, 28735},
+		{63, 28735},
+		{64, 28992},
+		{65, 532546},
+		{66, 532562},
+		{67, 6815811},
+		{68, 532548},
+		{69, 28741},
+		{70, 6815814},
+		{71, 6815815},
+		{72, 28744},
+		{73, 532553},
+		{74, 28746},
+		{75, 29003},
+		{76, 29003},
+		{77, 28749},
+		{78, -1},
+		{79, 28751},
+		{80, 6815783},
+		{81, 6815783},
+		{82, 6815783},
+		{83, 6815783},
+		{84, 6815783},
+		{85, 6815783},
+		{86, 6815783},
+		{87, 6815783},
+		{88, 532600},
+		{89, 6816603},
+		{90, 6816603},
+		{91, 6816603},
+		{92, 6816355},
+		{93, 6816355},
+		{94, 6816355},
+		{95, 6816603},
+		{96, 6816355},
+		{97, 6816355},
+		{98, 532600},
+		{99, 532600},
+		{100, 532600},
+		{101, 6816603},
+		{102, 6816355},
+		{103, 6816355},
+		{104, 6815848},
+		{105, 6815849},
+		{106, 28778},
+		{107, 28779},
+		{108, 28780},
+		{109, -1},
+		{110, 28968},
+		{111, -1},
+		{112, -1},
+		{113, -1},
+		{114, 28786},
+		{115, -1},
+		{116, -1},
+		{117, -1},
+		{118, 8323132},
+		{119, -1},
+		{120, 8257538},
+		{121, 8257538},
+		{122, 8257538},
+		{123, 8257538},
+		{124, 8257538},
+		{125, 8257538},
+		{126, 8257538},
+		{127, 8257538},
+		{256, 7082241},
+		{257, 7082241},
+		{258, 28930},
+		{259, 6819073},
+		{260, 30212},
+		{261, 6818053},
+		{262, 31238},
+		{263, 28679},
+		{267, 6816011},
+		{268, 6815756},
+		{816, 532785},
+		{817, 532785},
+		{820, 532787},
+		{1575, 6815783},
+		{1596, 6815804},
+		{1616, 6815783},
+		{1617, 6815783},
+		{2088, 28968},
+		{2092, 532785},
+		{2096, 532785},
+		{2097, 532785},
+		{2128, 6815783},
+		{2129, 6815783},
+		{2150, 6816355},
+		{3111, 6815783},
+		{3134, 28735},
+		{3170, 532600},
+		{3682, 532600},
+		{3686, 6816355},
+		{4120, 532480},
+		{4121, 532481},
+		{4148, 532787},
+		{4152, 532544},
+		{4154, 28986},
+		{4183, 6815783},
+		{4185, 6816603},
+		{4408, 532544},
+		{4441, 6816603},
+		{4608, 7082241},
+		{4612, 30212},
+		{4634, 532742},
+		{4641, 532497},
+		{4646, 6815783},
+		{4647, 6815783},
+		{4665, 30009},
+		{4671, 28735},
+		{4688, 6815783},
+		{4689, 6815783},
+		{4697, 6816603},
+		{4706, 532600},
+		{4707, 532600},
+		{4903, 6815783},
+		{4944, 6815783},
+		{4945, 6815783},
+		{4963, 532600},
+		{5158, 6815783},
+		{5182, 28735},
+		{5201, 6815783},
+		{5215, 6816603},
+		{6161, 655368},
+		{6182, 6815783},
+		{6192, 532785},
+		{6206, 28735},
+		{6225, 6815783},
+		{6229, 6815783},
+		{6406, 31238},
+		{6424, 532480},
+		{6481, 6815783},
+		{6919, 28679},
+		{6945, 532497},
+		{6948, 532497},
+		{6962, 28722},
+		{6974, 28735},
+		{7007, 6816603},
+		{7009, 6816355},
+		{7202, 532497},
+		{7273, 6815849},
+		{8194, 28930},
+		{8196, 30212},
+		{8197, 6818053},
+		{8208, 655368},
+		{8209, 655368},
+		{8211, 31507},
+		{8213, 6816277},
+		{8214, 28694},
+		{8218, 532742},
+		{8219, 535811},
+		{8227, 532499},
+		{8228, 532497},
+		{8231, 6815783},
+		{8244, 532787},
+		{8248, 532544},
+		{8252, 6815804},
+		{8254, 28735},
+		{8296, 6815848},
+		{8453, 6818053},
+		{8464, 655368},
+		{8465, 655368},
+		{8483, 532499},
+		{8709, 6818053},
+		{8720, 655368},
+		{8739, 532499},
+		{8966, 31238},
+		{8975, 28687},
+		{8976, 655368},
+		{8979, 31507},
+		{8985, 532481},
+		{8998, 6815783},
+		{9008, 532785},
+		{9015, 30769},
+		{9021, 533816},
+		{9046, 6815783},
+		{9058, 532600},
+		{9064, 6815848},
+		{9232, 655368},
+		{9488, 655368},
+		{9489, 655368},
+		{9532, 6815804},
+		{9744, 655368},
+		{10240, 7084292},
+		{10242, 28930},
+		{10244, 30212},
+		{10245, 6818053},
+		{10256, 655368},
+		{10259, 31507},
+		{10260, 32530},
+		{10265, 532481},
+		{10268, 535811},
+		{10270, 534277},
+		{10272, 532496},
+		{10273, 532497},
+		{10278, 6815783},
+		{10279, 6815783},
+		{10284, 532785},
+		{10286, -1},
+		{10288, 532785},
+		{10289, 532785},
+		{10292, 30004},
+		{10294, 6816603},
+		{10301, 533816},
+		{10303, 28735},
+		{10305, 533586},
+		{10306, 532562},
+		{10321, 6815783},
+		{10338, 532600},
+		{10339, 532600},
+		{10496, 7084292},
+		{10498, 28930},
+		{10501, 6818053},
+		{10521, 532481},
+		{10524, 535811},
+		{10526, 534277},
+		{10535, 6815783},
+		{10544, 532785},
+		{10545, 532785},
+		{10550, 6816603},
+		{10557, 28735},
+		{10559, 28735},
+		{10562, 532562},
+		{10577, 6815783},
+		{10594, 532600},
+		{10757, 6818053},
+		{10800, 532785},
+		{10813, 28735},
+		{10850, 532600},
+		{11032, 532480},
+		{11036, 535811},
+		{11037, 534277},
+		{11041, 532497},
+		{11045, 532497},
+		{11073, 532546},
+		{11524, 30212},
+		{11525, 6818053},
+		{11531, 6816011},
+		{11548, 532742},
+		{11552, 532496},
+		{11553, 532497},
+		{11568, 532785},
+		{11582, 28735},
+		{11583, 28735},
+		{11601, 6815783},
+		{11616, 6816355},
+		{16388, 30212},
+		{16391, 28679},
+		{16394, 28682},
+		{16396, 6815756},
+		{16400, 655368},
+		{16402, 532509},
+		{16403, 31507},
+		{16407, 28951},
+		{16422, 6815783},
+		{16423, 6815783},
+		{16433, 532785},
+		{16434, 28722},
+		{16438, 6816355},
+		{16439, 30769},
+		{16446, 28735},
+		{16447, 28735},
+		{16450, 532562},
+		{16464, 6815783},
+		{16467, 6815783},
+		{16468, 6815783},
+		{16469, 6815783},
+		{16471, 6815783},
+		{16472, 532600},
+		{16473, 6816603},
+		{16474, 6816603},
+		{16475, 6816603},
+		{16476, 6816355},
+		{16477, 6816355},
+		{16479, 6816603},
+		{16480, 6816355},
+		{16481, 6816355},
+		{16482, 532600},
+		{16483, 532600},
+		{16484, 532600},
+		{16485, 6816603},
+		{16486, 6816355},
+		{16487, 6816355},
+		{16495, -1},
+		{16501, -1},
+		{16502, 8323132},
+		{16647, 28679},
+		{16656, 655368},
+		{16658, 532509},
+		{16659, 31507},
+		{16671, 534277},
+		{16673, 532497},
+		{16678, 6815783},
+		{16689, 532785},
+		{16690, 28722},
+		{16720, 6815783},
+		{16722, 6815783},
+		{16724, 6815783},
+		{16727, 6815783},
+		{16729, 6816603},
+		{16730, 6816603},
+		{16732, 6816355},
+		{16733, 6816355},
+		{16736, 532600},
+		{16738, 532600},
+		{16739, 532600},
+		{16741, 6816603},
+		{16742, 6816355},
+		{16757, -1},
+		{16758, 8323132},
+		{16912, 655368},
+		{16914, 532509},
+		{16927, 534277},
+		{16934, 6815783},
+		{16976, 6815783},
+		{16986, 6816603},
+		{16987, 6816355},
+		{16991, 6816603},
+		{16992, 532600},
+		{16994, 532600},
+		{16995, 532600},
+		{16997, 532600},
+		{16998, 6816355},
+		{17013, -1},
+		{17168, 655368},
+		{17242, 6816603},
+		{17243, 6816355},
+		{17250, 532600},
+		{17251, 532600},
+		{17253, 6816603},
+		{17254, 6816355},
+		{17506, 532600},
+		{17509, 6816603},
+		{17510, 6816355},
+		{17762, 532600},
+		{17766, 6816355},
+		{18018, 532600},
+		{18021, 6816355},
+		{18274, 532600},
+		{18277, 6816355},
+		{18530, 532600},
+		{24590, -1},
+		{24591, -1},
+		{24600, -1},
+		{24601, 29209},
+		{24611, 532499},
+		{24614, 6815783},
+		{24657, 532600},
+		{24676, 532600},
+		{24677, 6816355},
+		{24680, -1},
+		{24681, -1},
+		{24683, -1},
+		{24687, -1},
+		{24688, -1},
+		{24691, -1},
+		{24692, -1},
+		{24844, -1},
+		{24846, -1},
+		{24847, -1},
+		{24867, 532499},
+		{24936, -1},
+		{24937, -1},
+		{24939, -1},
+		{24943, -1},
+		{24944, -1},
+		{24946, -1},
+		{25100, -1},
+		{25193, -1},
+		{25200, -1},
+		{25202, -1},
+		{25456, -1},
+		{25712, -1},
+		{25968, -1},
+		{26640, 655368},
+		{26641, 532509},
+		{26896, 655368},
+		{26897, 532509},
+		{26941, 533816},
+		{27152, 655368},
+		{27153, 532509},
+		{27197, 533816},
+		{27408, 655368},
+		{27409, 532509},
+		{27419, 535811},
+		{27453, 533816},
+		{27664, 655368},
+		{27665, 532509},
+		{27675, 535811},
+		{27709, 533816},
+		{27714, 533586},
+		{27920, 655368},
+		{27921, 532509},
+		{27931, 535811},
+		{27965, 533816},
+		{27970, 533586},
+		{28176, 655368},
+		{28177, 532509},
+		{28178, 655368},
+		{28187, 535811},
+		{28221, 533816},
+		{28226, 533586},
+		{28432, 532509},
+		{28433, 532509},
+		{28434, 532509},
+		{28443, 535811},
+		{28477, 533816},
+		{28482, 532562},
+		{28673, 7082241},
+		{28674, 7084292},
+		{28675, 6819073},
+		{28676, 30212},
+		{28677, 6818053},
+		{28678, 31238},
+		{28681, 6815753},
+		{28683, 6816011},
+		{28684, 6815756},
+		{28685, 6815757},
+		{28688, 532509},
+		{28689, 532509},
+		{28690, 532509},
+		{28691, 31507},
+		{28692, 32530},
+		{28693, 6816277},
+		{28695, 6816277},
+		{28697, 532481},
+		{28699, 535811},
+		{28700, 535811},
+		{28701, 534277},
+		{28702, 533253},
+		{28704, 532496},
+		{28705, 532497},
+		{28706, 532497},
+		{28707, 532499},
+		{28708, 532497},
+		{28709, 532497},
+		{28710, 6815783},
+		{28711, 6815783},
+		{28712, 28968},
+		{28715, 532496},
+		{28716, 532785},
+		{28717, 532785},
+		{28718, 6816046},
+		{28720, 532785},
+		{28721, 532785},
+		{28723, 28722},
+		{28724, 532787},
+		{28725, 28750},
+		{28726, 532787},
+		{28727, 30769},
+		{28728, 532544},
+		{28729, 30009},
+		{28730, 28986},
+		{28731, 29243},
+		{28732, 6815804},
+		{28733, 533816},
+		{28734, 28735},
+		{28736, 28992},
+		{28737, 532546},
+		{28738, 532562},
+		{28739, 6815811},
+		{28740, 532548},
+		{28742, 6815814},
+		{28743, 6815815},
+		{28745, 532553},
+		{28747, 29003},
+		{28752, 6815783},
+		{28753, 6815783},
+		{28755, 6815783},
+		{28756, -1},
+		{28758, 32336},
+		{28759, 32336},
+		{28760, 6816603},
+		{28761, 6816603},
+		{28762, 6816603},
+		{28763, 6816603},
+		{28764, 6818053},
+		{28766, 6816603},
+		{28767, 6816603},
+		{28769, 6816355},
+		{28770, 532600},
+		{28771, 6816355},
+		{28773, 6816355},
+		{28776, 6815848},
+		{28777, 6815849},
+		{28782, 28968},
+		{28928, 7082241},
+		{28931, 7082241},
+		{28932, 30212},
+		{28933, 30212},
+		{28934, 31238},
+		{28935, 28679},
+		{28939, 6816011},
+		{28944, 532509},
+		{28945, 532509},
+		{28946, 532509},
+		{28947, 31507},
+		{28949, 6816277},
+		{28950, 28694},
+		{28953, 532481},
+		{28954, 532742},
+		{28955, 535811},
+		{28956, 535811},
+		{28957, 534277},
+		{28958, 533253},
+		{28961, 28986},
+		{28962, 532497},
+		{28963, 532499},
+		{28964, 532497},
+		{28965, 6815783},
+		{28966, 6815783},
+		{28972, 532785},
+		{28973, 532785},
+		{28974, 28687},
+		{28976, 532785},
+		{28977, 532785},
+		{28978, 28722},
+		{28979, 28722},
+		{28981, 532787},
+		{28982, 532787},
+		{28984, 30264},
+		{28985, 30268},
+		{28987, 533816},
+		{28988, 28735},
+		{28989, 533816},
+		{28990, 28735},
+		{28991, 28735},
+		{28994, 29511},
+		{28996, 532548},
+		{29001, 29003},
+		{29008, 6815783},
+		{29009, 6815783},
+		{29011, 532600},
+		{29012, 6815783},
+		{29014, 32336},
+		{29015, 6815783},
+		{29016, 6816355},
+		{29017, 6816603},
+		{29018, 6816603},
+		{29022, 6816603},
+		{29023, 6816603},
+		{29025, 6816355},
+		{29026, 532600},
+		{29027, 6816603},
+		{29029, 6816355},
+		{29184, 7082241},
+		{29186, 30212},
+		{29187, 7082241},
+		{29188, 6818053},
+		{29189, 6818053},
+		{29191, 28679},
+		{29195, 6816011},
+		{29200, 32530},
+		{29201, 32530},
+		{29202, 532509},
+		{29203, 31507},
+		{29205, 6816277},
+		{29206, 28694},
+		{29207, 28951},
+		{29211, 535811},
+		{29212, 535811},
+		{29213, 533253},
+		{29214, 533253},
+		{29216, 532496},
+		{29217, 532497},
+		{29218, 532497},
+		{29222, 6815783},
+		{29223, 6815783},
+		{29232, 532785},
+		{29233, 532785},
+		{29236, 532787},
+		{29241, 30009},
+		{29242, 28986},
+		{29244, 28735},
+		{29245, 533816},
+		{29246, 28735},
+		{29247, 28735},
+		{29249, 532546},
+		{29255, 6815815},
+		{29257, 532553},
+		{29264, 6815783},
+		{29265, 32336},
+		{29268, 32336},
+		{29271, 6815783},
+		{29272, 532600},
+		{29273, 6816603},
+		{29274, 6816603},
+		{29277, 6816603},
+		{29278, 6816603},
+		{29279, 6816355},
+		{29282, 6816355},
+		{29283, 6816355},
+		{29285, 6816603},
+		{29440, 7082241},
+		{29443, 32530},
+		{29444, 6818053},
+		{29445, 30212},
+		{29447, 28679},
+		{29456, 532509},
+		{29457, 532509},
+		{29458, 532509},
+		{29459, 31507},
+		{29461, 6816277},
+		{29463, 28951},
+		{29464, 532480},
+		{29465, 532481},
+		{29466, 532742},
+		{29467, 537603},
+		{29468, 535811},
+		{29469, 534277},
+		{29470, 533253},
+		{29473, 532497},
+		{29478, 6815783},
+		{29479, 6815783},
+		{29485, 30769},
+		{29488, 532785},
+		{29489, 532785},
+		{29492, 532787},
+		{29496, 532544},
+		{29497, 30009},
+		{29500, 6815804},
+		{29501, 533816},
+		{29502, 28735},
+		{29503, 28735},
+		{29506, 533816},
+		{29513, 532553},
+		{29520, 6815783},
+		{29521, 6815783},
+		{29524, 6815783},
+		{29528, 6816603},
+		{29529, 6816603},
+		{29530, 6816603},
+		{29533, 6816355},
+		{29534, 6816603},
+		{29535, 6816603},
+		{29541, 6816355},
+		{29700, 30212},
+		{29701, 30212},
+		{29712, 532509},
+		{29713, 6823952},
+		{29714, 532509},
+		{29717, 6816277},
+		{29720, 532480},
+		{29721, 532481},
+		{29722, 532742},
+		{29723, 535811},
+		{29724, 535811},
+		{29725, 533253},
+		{29726, 534277},
+		{29734, 6815783},
+		{29735, 6815783},
+		{29744, 532785},
+		{29745, 532785},
+		{29752, 532544},
+		{29753, 30009},
+		{29756, 533816},
+		{29757, 533816},
+		{29758, 533816},
+		{29759, 28735},
+		{29762, 533586},
+		{29769, 29511},
+		{29776, 6815783},
+		{29777, 6815783},
+		{29780, 6815783},
+		{29784, 6816355},
+		{29785, 6816355},
+		{29790, 6816603},
+		{29791, 6816603},
+		{29797, 6816355},
+		{29956, 30212},
+		{29957, 6818053},
+		{29968, 532509},
+		{29969, 655368},
+		{29970, 532509},
+		{29973, 6816277},
+		{29976, 532480},
+		{29977, 532481},
+		{29978, 532742},
+		{29979, 535811},
+		{29980, 535811},
+		{29981, 533253},
+		{29982, 533253},
+		{29990, 6815783},
+		{29991, 6815783},
+		{30000, 532785},
+		{30001, 532785},
+		{30012, 6815804},
+		{30013, 533816},
+		{30014, 533816},
+		{30018, 532562},
+		{30032, 6815783},
+		{30033, 6815783},
+		{30036, 6815783},
+		{30040, 6816355},
+		{30041, 532600},
+		{30047, 6816603},
+		{30053, 6816355},
+		{30213, 30212},
+		{30224, 6823952},
+		{30225, 532509},
+		{30226, 532509},
+		{30229, 6816277},
+		{30232, 532736},
+		{30233, 532481},
+		{30234, 537603},
+		{30235, 535811},
+		{30236, 535811},
+		{30246, 6815783},
+		{30256, 532785},
+		{30257, 30769},
+		{30260, 29748},
+		{30265, 30009},
+		{30269, 28735},
+		{30270, 533816},
+		{30274, 532562},
+		{30288, 6815783},
+		{30289, 6815783},
+		{30292, 6815783},
+		{30296, 532600},
+		{30297, 6816355},
+		{30303, 6816603},
+		{30309, 6816603},
+		{30468, 30212},
+		{30469, 30212},
+		{30480, 532509},
+		{30481, 532509},
+		{30482, 532509},
+		{30485, 6816277},
+		{30488, 532480},
+		{30489, 532481},
+		{30490, 534277},
+		{30491, 535811},
+		{30492, 535811},
+		{30512, 532785},
+		{30513, 30769},
+		{30520, 532544},
+		{30524, 533816},
+		{30525, 6815804},
+		{30526, 28735},
+		{30530, 533586},
+		{30544, 6815783},
+		{30545, 6815783},
+		{30552, 532600},
+		{30553, 6816603},
+		{30559, 6816603},
+		{30724, 30212},
+		{30725, 30212},
+		{30736, 532509},
+		{30737, 532509},
+		{30741, 6816277},
+		{30745, 532481},
+		{30747, 534277},
+		{30750, 533253},
+		{30768, 532785},
+		{30776, 532544},
+		{30780, 533816},
+		{30781, 533816},
+		{30782, 28735},
+		{30786, 533586},
+		{30793, 532553},
+		{30800, 532600},
+		{30801, 6815783},
+		{30808, 6816603},
+		{30809, 6816603},
+		{30981, 6818053},
+		{30992, 532509},
+		{30993, 655368},
+		{30997, 6816277},
+		{31003, 535811},
+		{31024, 532785},
+		{31025, 30769},
+		{31032, 532544},
+		{31037, 533816},
+		{31038, 533816},
+		{31042, 533586},
+		{31056, 6816603},
+		{31057, 32336},
+		{31064, 532600},
+		{31065, 6816355},
+		{31232, 7077888},
+		{31234, 7084292},
+		{31235, 7082241},
+		{31236, 30212},
+		{31237, 6818053},
+		{31243, 6816011},
+		{31248, 32530},
+		{31249, 32530},
+		{31251, 31507},
+		{31253, 6816277},
+		{31259, 534277},
+		{31281, 532785},
+		{31288, 532544},
+		{31293, 533816},
+		{31298, 533586},
+		{31312, 532600},
+		{31313, 6815783},
+		{31320, 6816603},
+		{31321, 6816603},
+		{31488, 7082241},
+		{31491, 7082241},
+		{31492, 30212},
+		{31493, 6818053},
+		{31494, 31238},
+		{31504, 32530},
+		{31505, 32530},
+		{31509, 6816277},
+		{31515, 535811},
+		{31536, 532785},
+		{31537, 532785},
+		{31544, 533816},
+		{31549, 533816},
+		{31554, 533586},
+		{31568, 532600},
+		{31569, 6815783},
+		{31576, 6816603},
+		{31744, 7082241},
+		{31746, 7082241},
+		{31747, 7082241},
+		{31748, 30212},
+		{31749, 6818053},
+		{31750, 31238},
+		{31755, 6816011},
+		{31760, 32530},
+		{31761, 32530},
+		{31771, 535811},
+		{31792, 532785},
+		{31793, 532785},
+		{31805, 533816},
+		{31810, 533586},
+		{31824, 6815783},
+		{31825, 32336},
+		{31832, 532600},
+		{32000, 7084292},
+		{32016, 32530},
+		{32017, 32530},
+		{32027, 534277},
+		{32061, 533816},
+		{32066, 532562},
+		{32080, 6815783},
+		{32081, 6815783},
+		{32088, 532600},
+		{32272, 655368},
+		{32273, 532509},
+		{32274, 32530},
+		{32283, 535811},
+		{32317, 533816},
+		{32322, 532562},
+		{32337, 6815783},
+		{32344, 532600},
+		{32528, 532509},
+		{32529, 532509},
+		{32573, 533816},
+		{32578, 532562},
+		{32593, 6815783},
+		{524288, 532480},
+		{524289, 532481},
+		{524290, 532481},
+		{524291, 535811},
+		{524292, 534277},
+		{524293, 533253},
+		{524294, 532742},
+		{524304, 532496},
+		{524305, 532497},
+		{524306, 532497},
+		{524307, 532499},
+		{524336, 532785},
+		{524337, 532785},
+		{524344, 533816},
+		{524352, 532544},
+		{524370, 532562},
+		{524546, 532481},
+		{524547, 535811},
+		{524561, 532497},
+		{524562, 532497},
+		{524592, 532785},
+		{524593, 532785},
+		{524803, 535811},
+		{524817, 532497},
+		{525059, 535811},
+		{525315, 535811},
+		{525571, 535811},
+		{525827, 535811},
+		{526083, 535811},
+		{526339, 535811},
+		{532483, 535811},
+		{532484, 533253},
+		{532485, 533253},
+		{532486, 532742},
+		{532498, 532497},
+		{532510, 532509},
+		{532528, 532785},
+		{532529, 532785},
+		{532531, 532787},
+		{532536, 533816},
+		{532540, 6815804},
+		{532592, 31238},
+		{532593, 532509},
+		{532737, 532481},
+		{532739, 535811},
+		{532740, 533253},
+		{532741, 533253},
+		{532747, 6816011},
+		{532752, 532496},
+		{532753, 532497},
+		{532765, 532509},
+		{532784, 532785},
+		{532796, 6815804},
+		{532800, 532544},
+		{532818, 532562},
+		{532849, 532509},
+		{532992, 532480},
+		{532995, 535811},
+		{532996, 534277},
+		{532997, 533253},
+		{533021, 532509},
+		{533040, 532785},
+		{533041, 532785},
+		{533043, 532787},
+		{533048, 533816},
+		{533052, 6815804},
+		{533056, 532544},
+		{533058, 532546},
+		{533248, 532480},
+		{533251, 535811},
+		{533252, 533253},
+		{533254, 532742},
+		{533297, 532785},
+		{533299, 532787},
+		{533304, 533816},
+		{533312, 532544},
+		{533330, 532562},
+		{533507, 537603},
+		{533508, 533253},
+		{533509, 533253},
+		{533552, 532785},
+		{533555, 532787},
+		{533560, 533816},
+		{533763, 534277},
+		{533765, 533253},
+		{533808, 532785},
+		{533824, 532544},
+		{533842, 533586},
+		{534019, 535811},
+		{534021, 533253},
+		{534022, 532742},
+		{534072, 533816},
+		{534080, 532544},
+		{534098, 533586},
+		{534275, 535811},
+		{534278, 532742},
+		{534320, 532785},
+		{534354, 533586},
+		{534531, 535811},
+		{534533, 534277},
+		{534576, 532785},
+		{534577, 532785},
+		{534787, 535811},
+		{534789, 533253},
+		{534832, 532785},
+		{534833, 532785},
+		{535043, 535811},
+		{535045, 535811},
+		{535089, 532785},
+		{535299, 535811},
+		{535555, 535811},
+		{536067, 535811},
+		{536323, 535811},
+		{536579, 535811},
+		{536835, 535811},
+		{536887, 532787},
+		{537091, 535811},
+		{537347, 535811},
+		{537859, 535811},
+		{538115, 535811},
+		{538371, 534277},
+		{538627, 535811},
+		{655369, 655368},
+		{655370, 655368},
+		{655624, 655368},
+		{655625, 655368},
+		{655626, 655368},
+		{655880, 655368},
+		{655881, 655368},
+		{655882, 655368},
+		{656136, 655368},
+		{656137, 655368},
+		{656138, 655368},
+		{656392, 655368},
+		{656393, 655368},
+		{656394, 655368},
+		{656648, 655368},
+		{656649, 655368},
+		{656650, 655368},
+		{656904, 655368},
+		{656905, 655368},
+		{656906, 655368},
+		{657160, 655368},
+		{657161, 655368},
+		{657162, 655368},
+		{657416, 655368},
+		{657417, 655368},
+		{657418, 655368},
+		{657672, 655368},
+		{657673, 655368},
+		{657674, 655368},
+		{4194304, 8257538},
+		{4194305, 8257538},
+		{4194307, 8257538},
+		{4194320, 8257538},
+		{4194336, 8257538},
+		{4194337, 8257538},
+		{4194338, 8257538},
+		{4194339, 8257538},
+		{4194340, 8257538},
+		{4194341, 8257538},
+		{4194352, 8257538},
+		{4194353, 8257538},
+		{4194354, 8257538},
+		{4194358, 8257538},
+		{4194359, 8257538},
+		{4194368, 8257538},
+		{4194369, 8257538},
+		{4194370, 8257538},
+		{4194371, 8257538},
+		{4194372, 8257538},
+		{4194373, 8257538},
+		{4194374, 8257538},
+		{4194384, 8257538},
+		{4194385, 8257538},
+		{4194386, 8257538},
+		{4194387, 8257538},
+		{4194388, 8257538},
+		{4194389, 8257538},
+		{4194390, 8257538},
+		{4194391, 8257538},
+		{4194392, 8257538},
+		{4194393, 8257538},
+		{4194394, 8257538},
+		{4194400, 8257538},
+		{4194401, 8257538},
+		{4194402, 8257538},
+		{4194403, 8257538},
+		{4194404, 8257538},
+		{4194416, 8257538},
+		{4194417, 8257538},
+		{4194418, 8257538},
+		{4194419, 8257538},
+		{6815746, 7084292},
+		{6815747, 7082241},
+		{6815748, 30212},
+		{6815749, 6818053},
+		{6815759, 6816015},
+		{6815760, 532509},
+		{6815761, 532509},
+		{6815762, 532509},
+		{6815765, 6816277},
+		{6815770, 532742},
+		{6815771, 535811},
+		{6815772, 535811},
+		{6815773, 534277},
+		{6815774, 533253},
+		{6815776, 532496},
+		{6815778, 532497},
+		{6815782, 6815783},
+		{6815788, 532785},
+		{6815790, 6816046},
+		{6815793, 30769},
+		{6815794, 6816603},
+		{6815795, 6816603},
+		{6815801, 30009},
+		{6815802, 28986},
+		{6815803, 29243},
+		{6815806, 28735},
+		{6815809, 532546},
+		{6815810, 532562},
+		{6815812, 532548},
+		{6815817, 532553},
+		{6815824, 6815783},
+		{6815825, 6815783},
+		{6815828, 6815783},
+		{6815831, 32336},
+		{6815832, 6816355},
+		{6815833, 6816603},
+		{6815834, 32336},
+		{6815835, 6816603},
+		{6815836, 6816355},
+		{6815837, 6816603},
+		{6815838, 6816355},
+		{6815839, 6816603},
+		{6815841, 6816355},
+		{6815843, 6816355},
+		{6815844, 532600},
+		{6815845, 532600},
+		{6815847, 532600},
+		{6815850, 6816355},
+		{6815866, 8257538},
+		{6815869, 8257538},
+		{6815870, 8257538},
+		{6815871, 8257538},
+		{6816000, 7084292},
+		{6816002, 7084292},
+		{6816005, 6818053},
+		{6816016, 655368},
+		{6816017, 532509},
+		{6816018, 532509},
+		{6816021, 6816277},
+		{6816026, 532742},
+		{6816027, 535811},
+		{6816030, 533253},
+		{6816032, 532496},
+		{6816033, 532497},
+		{6816034, 532497},
+		{6816038, 6815783},
+		{6816039, 6815783},
+		{6816044, 532785},
+		{6816049, 30769},
+		{6816050, 28722},
+		{6816051, 28722},
+		{6816060, 6815804},
+		{6816062, 28735},
+		{6816068, 29511},
+		{6816070, 29511},
+		{6816071, 29511},
+		{6816073, 532553},
+		{6816081, 6815783},
+		{6816084, 6815783},
+		{6816087, 532600},
+		{6816088, 6816355},
+		{6816089, 6816603},
+		{6816090, 532600},
+		{6816094, 6816355},
+		{6816095, 6816355},
+		{6816097, 6816355},
+		{6816099, 532600},
+		{6816101, 6816603},
+		{6816104, 6816355},
+		{6816126, 8257538},
+		{6816256, 7084292},
+		{6816258, 7084292},
+		{6816259, 7082241},
+		{6816261, 6818053},
+		{6816272, 655368},
+		{6816273, 655368},
+		{6816274, 532509},
+		{6816283, 535811},
+		{6816286, 533253},
+		{6816288, 532496},
+		{6816289, 532497},
+		{6816290, 532497},
+		{6816294, 6815783},
+		{6816295, 6815783},
+		{6816302, 28687},
+		{6816306, 6816355},
+		{6816307, 6816603},
+		{6816316, 6815804},
+		{6816318, 28735},
+		{6816324, 29511},
+		{6816327, 6815815},
+		{6816329, 29511},
+		{6816337, 6815783},
+		{6816340, 6815783},
+		{6816343, 532600},
+		{6816344, 6816603},
+		{6816345, 6816603},
+		{6816346, 532600},
+		{6816350, 6816355},
+		{6816351, 6816603},
+		{6816353, 6816355},
+		{6816357, 6816355},
+		{6816512, 7082241},
+		{6816514, 7084292},
+		{6816515, 7082241},
+		{6816517, 6818053},
+		{6816528, 655368},
+		{6816529, 655368},
+		{6816530, 532509},
+		{6816533, 6816277},
+		{6816539, 535811},
+		{6816545, 532497},
+		{6816550, 6815783},
+		{6816551, 6815783},
+		{6816562, 6816603},
+		{6816563, 6816355},
+		{6816572, 6815804},
+		{6816574, 32336},
+		{6816592, 6815783},
+		{6816593, 32336},
+		{6816599, 532600},
+		{6816600, 6816355},
+		{6816601, 6816603},
+		{6816602, 6816603},
+		{6816606, 6816355},
+		{6816607, 6816355},
+		{6816611, 6818053},
+		{6816613, 6816603},
+		{6816768, 7082241},
+		{6816772, 7084292},
+		{6816784, 655368},
+		{6816785, 655368},
+		{6816795, 535811},
+		{6816806, 6815783},
+		{6816807, 6815783},
+		{6816817, 532785},
+		{6816818, 6816603},
+		{6816819, 6816355},
+		{6816830, 532600},
+		{6816848, 532600},
+		{6816849, 532600},
+		{6816855, 532600},
+		{6816856, 6816603},
+		{6816857, 6816603},
+		{6816858, 6816603},
+		{6816859, 6816355},
+		{6816862, 6816355},
+		{6816863, 6816355},
+		{6816869, 6816355},
+		{6817024, 7082241},
+		{6817026, 7084292},
+		{6817028, 7084292},
+		{6817040, 655368},
+		{6817041, 32530},
+		{6817045, 6816277},
+		{6817051, 535811},
+		{6817062, 6815783},
+		{6817063, 6815783},
+		{6817073, 532785},
+		{6817075, 32336},
+		{6817086, 6815783},
+		{6817104, 6815783},
+		{6817105, 532600},
+		{6817111, 532600},
+		{6817112, 6816355},
+		{6817113, 6816355},
+		{6817114, 6816603},
+		{6817118, 6816603},
+		{6817125, 6816355},
+		{6817280, 7082241},
+		{6817296, 655368},
+		{6817297, 32530},
+		{6817301, 6816277},
+		{6817307, 535811},
+		{6817318, 6815783},
+		{6817319, 6815783},
+		{6817328, 532785},
+		{6817329, 532785},
+		{6817331, 6816603},
+		{6817342, 28735},
+		{6817361, 532600},
+		{6817367, 532600},
+		{6817368, 6816355},
+		{6817369, 6816603},
+		{6817374, 6816355},
+		{6817375, 6816603},
+		{6817381, 6816355},
+		{6817552, 655368},
+		{6817553, 32530},
+		{6817563, 535811},
+		{6817574, 6815783},
+		{6817575, 6815783},
+		{6817587, 28735},
+		{6817617, 6815783},
+		{6817623, 532600},
+		{6817624, 532600},
+		{6817637, 6816603},
+		{6817792, 7084292},
+		{6817808, 32530},
+		{6817819, 535811},
+		{6817830, 6815783},
+		{6817844, 532787},
+		{6817845, 532787},
+		{6817873, 32336},
+		{6817879, 532600},
+		{6817880, 532600},
+		{6817893, 6816355},
+		{6818064, 32530},
+		{6818086, 6815783},
+		{6818099, 6816603},
+		{6818129, 32336},
+		{6818135, 532600},
+		{6818136, 532600},
+		{6818149, 6816355},
+		{6818304, 7082241},
+		{6818320, 32530},
+		{6818321, 655368},
+		{6818342, 6815783},
+		{6818385, 32336},
+		{6818392, 532600},
+		{6818405, 6816355},
+		{6818560, 7082241},
+		{6818577, 655368},
+		{6818598, 6815783},
+		{6818641, 532600},
+		{6818648, 532600},
+		{6818661, 6816355},
+		{6818816, 7084292},
+		{6818832, 655368},
+		{6818897, 532600},
+		{6818904, 532600},
+		{6819072, 6819073},
+		{6819075, 6819073},
+		{6819089, 655368},
+		{6819153, 532600},
+		{6819160, 532600},
+		{6819328, 6819073},
+		{6819329, 6819073},
+		{6819331, 6819073},
+		{6819409, 32336},
+		{6819416, 532600},
+		{6819584, 6819073},
+		{6819587, 6819073},
+		{6819665, 6815783},
+		{6819672, 532600},
+		{6819921, 6815783},
+		{6819928, 532600},
+		{6820177, 6815783},
+		{6820184, 532600},
+		{6820352, 7082241},
+		{6820353, 7082241},
+		{6820440, 6816603},
+		{6820608, 7082241},
+		{6820611, 7082241},
+		{6820624, 655368},
+		{6820696, 6818053},
+		{6820864, 7082241},
+		{6820867, 7082241},
+		{6820945, 28735},
+		{6820952, 6816355},
+		{6821208, 6816355},
+		{6821392, 655368},
+		{6821464, 6816355},
+		{6822160, 655368},
+		{6822928, 655368},
+		{6823184, 655368},
+		{6823440, 655368},
+		{6823961, 532481},
+		{6824208, 6823952},
+		{6824464, 6823952},
+		{6824720, 6823952},
+		{7078146, 7082241},
+		{7079425, 7082241},
+		{7081984, -1},
+		{7081985, 7082241},
+		{7081986, 7082241},
+		{7081987, -1},
+		{7081988, -1},
+		{7081989, -1},
+		{7082243, -1},
+		{7082244, -1},
+		{7082496, 7082241},
+		{7082499, -1},
+		{7082500, -1},
+		{7082754, -1},
+		{7082755, -1},
+		{7082756, -1},
+		{7083011, -1},
+		{7083012, -1},
+		{7083267, -1},
+		{7083268, -1},
+		{7083521, 7082241},
+		{7083523, -1},
+		{7083776, 7084292},
+		{7083777, 7082241},
+		{7083779, -1},
+		{7083780, -1},
+		{7084036, -1},
+		{7084290, 7084292},
+		{7084544, -1},
+		{7084547, -1},
+		{7084548, 7084292},
+		{7084800, -1},
+		{7084803, 7082241},
+		{7085056, -1},
+		{7085059, 7082241},
+		{7085312, -1},
+		{7085568, 7082241},
+		{7085824, 7082241},
+		{7086082, 7084292},
+		{7733248, 8323163},
+		{7733256, 8323163},
+		{7733264, 8323159},
+		{7733272, 8323132},
+		{7733273, 8323132},
+		{7733280, 8323113},
+		{7733288, 8323113},
+		{7733296, 8323120},
+		{7733304, 8257538},
 		{7798784, 7082241},
-		{7800832, 7082241},
-		{7802880, 7082241},
 		{7798785, 7082241},
-		{7800833, 7082241},
 		{7798786, 7082241},
-		{7800834, 7082241},
 		{7798787, 6819073},
-		{7800835, 6819073},
 		{7798788, 30212},
-		{7800836, 30212},
-		{7802884, 30212},
-		{7804932, 30212},
 		{7798789, 6818053},
-		{7800837, 6818053},
-		{7802885, 6818053},
 		{7798790, 31238},
-		{7800838, 31238},
-		{7802886, 31238},
-		{7804934, 31238},
 		{7798791, 28679},
 		{7798792, 28680},
 		{7798793, 6815753},
 		{7798794, 28682},
 		{7798795, 6816011},
-		{7800843, 6816011},
 		{7798796, 6815756},
-		{7800844, 6815756},
 		{7798797, 6815757},
 		{7798798, 28686},
-		{7800846, -1},
-		{7801102, -1},
 		{7798799, -1},
 		{7798800, 655368},
-		{7800848, 655368},
-		{7802896, 655368},
-		{7806992, 655368},
 		{7798801, 655368},
-		{7800849, 655368},
-		{7806993, 655368},
 		{7798802, 532509},
 		{7798803, 31507},
-		{7800851, 31507},
-		{7802899, 31507},
 		{7798804, -1},
 		{7798805, 6816277},
-		{7800853, 6816277},
 		{7798806, 28694},
 		{7798807, 28951},
 		{7798808, 532480},
-		{7800856, -1},
-		{7802904, 532480},
-		{7807000, 532480},
 		{7798809, 532481},
-		{7800857, 532481},
-		{7802905, 29209},
 		{7798810, 532742},
-		{7800858, 537603},
 		{7798811, 535811},
-		{7800859, 535811},
 		{7798812, 535811},
-		{7800860, 535811},
-		{7802908, 535811},
 		{7798813, 534277},
 		{7798814, 533253},
-		{7800862, 533253},
 		{7798815, 533253},
-		{7800863, 533253},
 		{7798816, 532496},
 		{7798817, 532497},
 		{7798818, 532497},
@@ -2515,13 +2242,8 @@ namespace
 		{7798820, 532497},
 		{7798821, 532497},
 		{7798822, 6815783},
-		{7799078, 6815783},
-		{7800870, 6815783},
 		{7798823, 6815783},
-		{7800871, 6815783},
-		{7802919, 6815783},
 		{7798824, 28968},
-		{7800872, 28968},
 		{7798825, 28713},
 		{7798826, 28714},
 		{7798827, 532496},
@@ -2530,31 +2252,21 @@ namespace
 		{7798830, 6816046},
 		{7798831, 28719},
 		{7798832, 532785},
-		{7800880, 532785},
 		{7798833, 532785},
 		{7798834, 28722},
-		{7800882, 28722},
 		{7798835, 28722},
 		{7798836, 532787},
-		{7807028, 532787},
 		{7798837, 532787},
 		{7798838, 532787},
 		{7798839, 30769},
 		{7798840, 532544},
 		{7798841, 30009},
-		{7799097, 30009},
 		{7798842, 28986},
 		{7798843, 29243},
 		{7798844, 6815804},
-		{7799100, 6815804},
 		{7798845, 533816},
-		{7800893, 533816},
 		{7798846, 28735},
-		{7800894, 28735},
-		{7802942, 28735},
 		{7798847, 28735},
-		{7800895, 28735},
-		{7802943, 28735},
 		{7798848, 28992},
 		{7798849, 532546},
 		{7798850, 532562},
@@ -2572,11 +2284,7 @@ namespace
 		{7798862, -1},
 		{7798863, 28751},
 		{7798864, -1},
-		{7799120, -1},
-		{7800912, -1},
 		{7798865, -1},
-		{7799121, -1},
-		{7800913, -1},
 		{7798866, -1},
 		{7798867, -1},
 		{7798868, -1},
@@ -2594,20 +2302,15 @@ namespace
 		{7798880, 6816355},
 		{7798881, 6816355},
 		{7798882, 6816355},
-		{7799138, 532600},
 		{7798883, 6816355},
 		{7798884, 6816355},
 		{7798885, 6816355},
 		{7798886, 6816355},
-		{7799142, 6816355},
-		{7799398, 6816355},
 		{7798887, 6816355},
 		{7798888, 6815848},
-		{7799144, 6815848},
 		{7798889, 6815849},
 		{7798890, 28778},
 		{7798891, 28779},
-		{7800939, -1},
 		{7798892, 28780},
 		{7798893, -1},
 		{7798894, 28968},
@@ -2616,65 +2319,388 @@ namespace
 		{7798897, -1},
 		{7798898, 28786},
 		{7798899, -1},
-		{7800947, -1},
 		{7798900, -1},
-		{7800948, -1},
 		{7798901, -1},
-		{7800949, -1},
 		{7798902, 8323132},
-		{7800950, 8323132},
-		{7801206, 8323132},
 		{7798903, -1},
 		{7798904, 8257538},
-		{7799160, 8257538},
-		{7799416, 8257538},
 		{7798905, 8257538},
-		{7799161, 8257538},
 		{7798906, 8257538},
-		{7799162, 8257538},
-		{7799418, 8257538},
-		{7799674, 8257538},
-		{7799930, 8257538},
-		{7800186, 8257538},
 		{7798907, 8257538},
-		{7799163, 8257538},
-		{7799419, 8257538},
-		{7799675, 8257538},
 		{7798908, 8257538},
-		{7799164, 8257538},
-		{7799420, 8257538},
-		{7799676, 8257538},
-		{7799932, 8257538},
-		{7800188, 8257538},
 		{7798909, 8257538},
+		{7798910, 8257538},
+		{7798911, 8257538},
+		{7799078, 6815783},
+		{7799097, 30009},
+		{7799100, 6815804},
+		{7799120, -1},
+		{7799121, -1},
+		{7799138, 532600},
+		{7799142, 6816355},
+		{7799144, 6815848},
+		{7799160, 8257538},
+		{7799161, 8257538},
+		{7799162, 8257538},
+		{7799163, 8257538},
+		{7799164, 8257538},
 		{7799165, 8257538},
+		{7799166, 8257538},
+		{7799167, 8257538},
+		{7799398, 6816355},
+		{7799416, 8257538},
+		{7799418, 8257538},
+		{7799419, 8257538},
+		{7799420, 8257538},
 		{7799421, 8257538},
+		{7799422, 8257538},
+		{7799423, 8257538},
+		{7799674, 8257538},
+		{7799675, 8257538},
+		{7799676, 8257538},
 		{7799677, 8257538},
+		{7799678, 8257538},
+		{7799679, 8257538},
+		{7799930, 8257538},
+		{7799932, 8257538},
 		{7799933, 8257538},
+		{7799934, 8257538},
+		{7800186, 8257538},
+		{7800188, 8257538},
 		{7800189, 8257538},
+		{7800190, 8257538},
 		{7800445, 8257538},
 		{7800701, 8257538},
+		{7800832, 7082241},
+		{7800833, 7082241},
+		{7800834, 7082241},
+		{7800835, 6819073},
+		{7800836, 30212},
+		{7800837, 6818053},
+		{7800838, 31238},
+		{7800843, 6816011},
+		{7800844, 6815756},
+		{7800846, -1},
+		{7800848, 655368},
+		{7800849, 655368},
+		{7800851, 31507},
+		{7800853, 6816277},
+		{7800856, -1},
+		{7800857, 532481},
+		{7800858, 537603},
+		{7800859, 535811},
+		{7800860, 535811},
+		{7800862, 533253},
+		{7800863, 533253},
+		{7800870, 6815783},
+		{7800871, 6815783},
+		{7800872, 28968},
+		{7800880, 532785},
+		{7800882, 28722},
+		{7800893, 533816},
+		{7800894, 28735},
+		{7800895, 28735},
+		{7800912, -1},
+		{7800913, -1},
+		{7800939, -1},
+		{7800947, -1},
+		{7800948, -1},
+		{7800949, -1},
+		{7800950, 8323132},
 		{7800957, 8257538},
+		{7801102, -1},
+		{7801206, 8323132},
 		{7801213, 8257538},
-		{7798910, 8257538},
-		{7799166, 8257538},
-		{7799422, 8257538},
-		{7799678, 8257538},
-		{7799934, 8257538},
-		{7800190, 8257538},
-		{7798911, 8257538},
-		{7799167, 8257538},
-		{7799423, 8257538},
-		{7799679, 8257538},
-		{7733248, 8323163},
-		{7733256, 8323163},
-		{7733264, 8323159},
-		{7733272, 8323132},
-		{7733273, 8323132},
-		{7733280, 8323113},
-		{7733288, 8323113},
-		{7733296, 8323120},
-		{7733304, 8257538},
+		{7802880, 7082241},
+		{7802884, 30212},
+		{7802885, 6818053},
+		{7802886, 31238},
+		{7802896, 655368},
+		{7802899, 31507},
+		{7802904, 532480},
+		{7802905, 29209},
+		{7802908, 535811},
+		{7802919, 6815783},
+		{7802942, 28735},
+		{7802943, 28735},
+		{7804932, 30212},
+		{7804934, 31238},
+		{7806992, 655368},
+		{7806993, 655368},
+		{7807000, 532480},
+		{7807028, 532787},
+		{7864320, 8323163},
+		{7864328, 8323163},
+		{7864336, 8323159},
+		{7864344, 8323159},
+		{7864345, 8323132},
+		{7864352, 8323113},
+		{7864360, 8323113},
+		{7864368, 8323120},
+		{7864376, 8257538},
+		{7929856, 7082241},
+		{7929857, 7082241},
+		{7929858, 28930},
+		{7929859, 6819073},
+		{7929860, 30212},
+		{7929861, 6818053},
+		{7929862, 31238},
+		{7929863, 28679},
+		{7929864, 28680},
+		{7929865, 6815753},
+		{7929866, 28682},
+		{7929867, 6816011},
+		{7929868, 6815756},
+		{7929869, 6815757},
+		{7929870, 28686},
+		{7929871, 28687},
+		{7929872, 655368},
+		{7929873, 655368},
+		{7929874, 532509},
+		{7929875, 31507},
+		{7929876, -1},
+		{7929877, 6816277},
+		{7929878, 28694},
+		{7929879, 28951},
+		{7929880, 532480},
+		{7929881, 532481},
+		{7929882, 532742},
+		{7929883, 535811},
+		{7929884, 535811},
+		{7929885, 534277},
+		{7929886, 533253},
+		{7929887, 533253},
+		{7929888, 532496},
+		{7929889, 532497},
+		{7929890, 532497},
+		{7929891, 532499},
+		{7929892, 532497},
+		{7929893, 532497},
+		{7929894, 6815783},
+		{7929895, 6815783},
+		{7929896, 28968},
+		{7929897, 28713},
+		{7929898, 28714},
+		{7929899, 532496},
+		{7929900, 532785},
+		{7929901, 532785},
+		{7929902, 6816046},
+		{7929903, 28719},
+		{7929904, 532785},
+		{7929905, 532785},
+		{7929906, 28722},
+		{7929907, 28722},
+		{7929908, 532787},
+		{7929909, 532787},
+		{7929910, 6816355},
+		{7929911, 30769},
+		{7929912, 532544},
+		{7929913, 30009},
+		{7929914, 28986},
+		{7929915, 29243},
+		{7929916, 6815804},
+		{7929917, 533816},
+		{7929918, 28735},
+		{7929919, 28735},
+		{7929920, 28992},
+		{7929921, 532546},
+		{7929922, 532562},
+		{7929923, 6815811},
+		{7929924, 532548},
+		{7929925, 28741},
+		{7929926, 6815814},
+		{7929927, 6815815},
+		{7929928, 28744},
+		{7929929, 532553},
+		{7929930, 28746},
+		{7929931, 29003},
+		{7929932, 29003},
+		{7929933, 28749},
+		{7929934, -1},
+		{7929935, 28751},
+		{7929936, 6815783},
+		{7929937, 6815783},
+		{7929938, 6815783},
+		{7929939, 6815783},
+		{7929940, 6815783},
+		{7929941, 6815783},
+		{7929942, 6815783},
+		{7929943, 6815783},
+		{7929944, 532600},
+		{7929945, 6816603},
+		{7929946, 6816603},
+		{7929947, 6816603},
+		{7929948, 6816603},
+		{7929949, 6816603},
+		{7929950, 6816603},
+		{7929951, 6816603},
+		{7929952, 8257538},
+		{7929953, 6816355},
+		{7929954, 6816355},
+		{7929955, 6816355},
+		{7929956, 6816355},
+		{7929957, 6816355},
+		{7929958, 532600},
+		{7929959, 532600},
+		{7929960, 6815848},
+		{7929961, 6815849},
+		{7929962, 28778},
+		{7929963, 28779},
+		{7929964, 28780},
+		{7929965, -1},
+		{7929966, 28968},
+		{7929967, -1},
+		{7929968, -1},
+		{7929969, -1},
+		{7929970, 28786},
+		{7929971, -1},
+		{7929972, -1},
+		{7929973, -1},
+		{7929974, 8323132},
+		{7929975, -1},
+		{7929976, 8257538},
+		{7929977, 8257538},
+		{7929978, 8257538},
+		{7929979, 8257538},
+		{7929980, 8257538},
+		{7929981, 8257538},
+		{7929982, 8257538},
+		{7929983, 8257538},
+		{7930112, 7082241},
+		{7930113, 7082241},
+		{7930114, 28930},
+		{7930115, 6819073},
+		{7930116, 30212},
+		{7930117, 6818053},
+		{7930118, 31238},
+		{7930119, 28679},
+		{7930123, 6816011},
+		{7930124, 6815756},
+		{7930126, -1},
+		{7930128, 655368},
+		{7930129, 655368},
+		{7930131, 31507},
+		{7930132, -1},
+		{7930133, 6816277},
+		{7930136, -1},
+		{7930137, 532481},
+		{7930138, 537603},
+		{7930139, 535811},
+		{7930140, 535811},
+		{7930141, 534277},
+		{7930142, 533253},
+		{7930143, 533253},
+		{7930145, 532497},
+		{7930150, 6815783},
+		{7930151, 6815783},
+		{7930152, 28968},
+		{7930158, -1},
+		{7930160, 532785},
+		{7930162, 28722},
+		{7930164, 532787},
+		{7930165, 532787},
+		{7930166, 6816355},
+		{7930167, 532785},
+		{7930168, 532544},
+		{7930169, 30009},
+		{7930171, 29243},
+		{7930172, 6815804},
+		{7930173, 533816},
+		{7930174, 28735},
+		{7930175, 28735},
+		{7930192, 6815783},
+		{7930193, 6815783},
+		{7930196, 6815783},
+		{7930199, 6815783},
+		{7930201, 6816603},
+		{7930203, 6816603},
+		{7930210, 532600},
+		{7930214, 532600},
+		{7930216, 6815848},
+		{7930219, -1},
+		{7930227, -1},
+		{7930228, -1},
+		{7930229, -1},
+		{7930230, 8323132},
+		{7930232, 8257538},
+		{7930233, 8257538},
+		{7930234, 8257538},
+		{7930235, 8257538},
+		{7930236, 8257538},
+		{7930237, 8257538},
+		{7930238, 8257538},
+		{7930239, 8257538},
+		{7930368, 7082241},
+		{7930372, 30212},
+		{7930373, 6818053},
+		{7930374, 31238},
+		{7930382, -1},
+		{7930384, 655368},
+		{7930385, 655368},
+		{7930387, 31507},
+		{7930392, 532480},
+		{7930393, 29209},
+		{7930395, 535811},
+		{7930396, 535811},
+		{7930398, 533253},
+		{7930406, 6815783},
+		{7930407, 6815783},
+		{7930416, 532785},
+		{7930423, 532785},
+		{7930425, 30009},
+		{7930430, 28735},
+		{7930431, 28735},
+		{7930448, 6816355},
+		{7930449, 6815783},
+		{7930470, 532600},
+		{7930486, 8323132},
+		{7930488, 8257538},
+		{7930490, 8257538},
+		{7930491, 8257538},
+		{7930492, 8257538},
+		{7930493, 8257538},
+		{7930494, 8257538},
+		{7930495, 8257538},
+		{7930628, 30212},
+		{7930629, 6818053},
+		{7930630, 31238},
+		{7930640, 655368},
+		{7930648, 532480},
+		{7930649, 532481},
+		{7930652, 532742},
+		{7930662, 6815783},
+		{7930663, 6815783},
+		{7930679, 532785},
+		{7930686, 28735},
+		{7930705, 6815783},
+		{7930746, 8257538},
+		{7930747, 8257538},
+		{7930748, 8257538},
+		{7930749, 8257538},
+		{7930750, 8257538},
+		{7930751, 8257538},
+		{7930885, 6818053},
+		{7930918, 6815783},
+		{7930961, 532600},
+		{7931002, 8257538},
+		{7931004, 8257538},
+		{7931005, 8257538},
+		{7931006, 8257538},
+		{7931258, 8257538},
+		{7931260, 8257538},
+		{7931261, 8257538},
+		{7931262, 8257538},
+		{7931517, 8257538},
+		{7931773, 8257538},
+		{7932029, 8257538},
+		{7932285, 8257538},
+		{8257536, 8257538},
+		{8257537, 8257538},
+		{8257539, 8257538},
+		{8257544, 8257538},
+		{8257571, 8257603},
+		{8257579, 8257576},
+		{8283136, -1},
 		{8285952, -1},
 		{8285953, -1},
 		{8285954, -1},
@@ -2682,46 +2708,25 @@ namespace
 		{8285956, -1},
 		{8285957, -1},
 		{8286304, -1},
-		{8283136, -1},
-		{7081984, -1},
-		{7084544, -1},
-		{7084800, -1},
-		{7085056, -1},
-		{7084547, -1},
-		{7081987, -1},
-		{7082755, -1},
-		{7082243, -1},
-		{7082499, -1},
-		{7083011, -1},
-		{7083267, -1},
-		{7083523, -1},
-		{7083779, -1},
-		{7085312, -1},
-		{7081988, -1},
-		{7082756, -1},
-		{7082244, -1},
-		{7083268, -1},
-		{7083012, -1},
-		{7084036, -1},
-		{7082500, -1},
-		{7083780, -1},
-		{7081989, -1},
-		{7082754, -1},
-		{31232, 7077888},
-		{6820352, 7082241},
-		{6817280, 7082241},
-		{31744, 7082241},
-		{6820608, 7082241},
-		{6820353, 7082241},
-		{31488, 7082241},
-		{6820611, 7082241},
-		{31746, 7082241},
-		{6820864, 7082241},
-		{31491, 7082241},
-		{31747, 7082241},
-		{6820867, 7082241},
-		{7085568, 7082241},
-		{6819072, 6819073},
+		{8323072, 8323163},
+		{8323073, 8323163},
+		{8323076, 8323159},
+		{8323080, 8323163},
+		{8323088, 8323159},
+		{8323096, 8323132},
+		{8323097, 8323132},
+		{8323099, 8323132},
+		{8323104, 8323163},
+		{8323112, 8323113},
+		{8323128, 8323132},
+		{8323129, 8323132},
+		{8323130, 8323132},
+		{8323131, 8323132},
+		{8323133, 8323132},
+		{8323158, 8323159},
+		{8323160, 8323159},
+		{8323161, 8323163},
+		{8323162, 8323159},
 	};
 
 	ReverbEffectList reverbEffects = {
@@ -2787,20 +2792,200 @@ namespace
 	};
 }
 
-Voice::Voice(int num, String path, String type)
-	: num(num), path(path), type(type)
+namespace
+{
+	template <size_t N>
+	constexpr bool IsSorted(const VoiceMapping (&mappings)[N])
+	{
+		for (size_t i = 1; i < N; i++)
+		{
+			if (mappings[i - 1].num >= mappings[i].num)
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	template <size_t N>
+	constexpr bool IsWellFormed(const VoiceDef (&defs)[N])
+	{
+		for (size_t i = 0; i < N; i++)
+		{
+			if (!(0 < defs[i].category1 && defs[i].category1 < defs[i].category2 &&
+				defs[i].category2 < defs[i].title && defs[i].title < defs[i].titleEnd))
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	static_assert(IsSorted(voiceMap), "voiceMap must be sorted by voice number");
+	static_assert(IsWellFormed(voiceDefs), "voice path must have form PRESET:/VOICE/Category1/Category2/Title.Type");
+
+	// FNV-1a
+	struct RawStringHash
+	{
+		size_t operator()(const char* str) const
+		{
+			uint64 hash = 14695981039346656037ULL;
+			for (; *str; str++)
+			{
+				hash = (hash ^ (uint8)*str) * 1099511628211ULL;
+			}
+			return (size_t)hash;
+		}
+	};
+
+	struct RawStringEqual
+	{
+		bool operator()(const char* str1, const char* str2) const { return strcmp(str1, str2) == 0; }
+	};
+
+	struct NumEntry
+	{
+		Voice* voice; // nullptr for known num voices without proper mapping
+		bool mapped; // found via voiceMap, shown with category name
+	};
+
+	// Lookup tables for VoiceTitle and FindVoice, built once on first use.
+	// Keys point into the constant catalogue, no strings are created.
+	struct VoiceIndex
+	{
+		std::unordered_map<const char*, Voice*, RawStringHash, RawStringEqual> byPath;
+		std::unordered_map<int, NumEntry> byNum;
+
+		VoiceIndex()
+		{
+			VoiceList& voices = Presets::Voices();
+			byPath.reserve(voices.size());
+			byNum.reserve(voices.size() + numElementsInArray(voiceMap));
+
+			// emplace keeps the first entry for duplicates, same as a linear search did
+			for (Voice& vc : voices)
+			{
+				byPath.emplace(vc.GetRawPath(), &vc);
+				byNum.emplace(vc.GetNum(), NumEntry{&vc, false});
+			}
+
+			for (const VoiceMapping& mapping : voiceMap)
+			{
+				if (mapping.target == -1)
+				{
+					byNum.emplace(mapping.num, NumEntry{nullptr, true});
+					continue;
+				}
+
+				auto target = byNum.find(mapping.target);
+				if (target != byNum.end() && !target->second.mapped)
+				{
+					byNum.emplace(mapping.num, NumEntry{target->second.voice, true});
+				}
+			}
+		}
+	};
+
+	VoiceIndex& Index()
+	{
+		static VoiceIndex index;
+		return index;
+	}
+
+	// Trigram index for SearchVoices, built once on first use.
+	// Each voice is represented by lower case text "category1/category2/title/type",
+	// every three-byte sequence of the text refers to the list of voices containing it.
+	struct SearchIndex
+	{
+		std::vector<std::string> texts;
+		std::unordered_map<uint32, std::vector<uint16>> trigrams;
+
+		static uint32 Trigram(const char* str)
+		{
+			return (uint32)(uint8)str[0] << 16 | (uint32)(uint8)str[1] << 8 | (uint8)str[2];
+		}
+
+		SearchIndex()
+		{
+			texts.reserve(numElementsInArray(voiceDefs));
+
+			for (const VoiceDef& def : voiceDefs)
+			{
+				std::string text(def.path + def.category1, def.path + def.titleEnd);
+				text += '/';
+				text += def.type;
+				for (char& ch : text)
+				{
+					// non-ASCII characters of the catalogue are already lower case
+					ch = (char)tolower((uint8)ch);
+				}
+
+				const uint16 index = (uint16)texts.size();
+				for (size_t i = 0; i + 3 <= text.size(); i++)
+				{
+					std::vector<uint16>& voices = trigrams[Trigram(&text[i])];
+					if (voices.empty() || voices.back() != index)
+					{
+						voices.push_back(index);
+					}
+				}
+
+				texts.push_back(std::move(text));
+			}
+		}
+	};
+
+	SearchIndex& Search()
+	{
+		static SearchIndex index;
+		return index;
+	}
+}
+
+const String& Voice::Text(String& text, const char* begin, const char* end) const
+{
+	if (text.isEmpty())
+	{
+		text = String::fromUTF8(begin, (int)(end - begin));
+	}
+	return text;
+}
+
+const String& Voice::GetPath() const
+{
+	return Text(m_path, m_def->path, m_def->path + strlen(m_def->path));
+}
+
+const String& Voice::GetType() const
+{
+	return Text(m_type, m_def->type, m_def->type + strlen(m_def->type));
+}
+
+const String& Voice::GetTitle() const
+{
+	return Text(m_title, m_def->path + m_def->title, m_def->path + m_def->titleEnd);
+}
+
+const String& Voice::GetCategory1() const
+{
+	return Text(m_category1, m_def->path + m_def->category1, m_def->path + m_def->category2 - 1);
+}
+
+const String& Voice::GetCategory2() const
 {
-	int bcategory1 = path.indexOf(path.indexOf(0, "/") + 1, "/");
-	int bcategory2 = path.indexOf(bcategory1 + 1, "/");
-	int btitle = path.indexOf(bcategory2 + 1, "/");
-	int etitle = path.indexOf(btitle, ".");
-	title = path.substring(btitle + 1, etitle);
-	category1 = path.substring(bcategory1 + 1, bcategory2);
-	category2 = path.substring(bcategory2 + 1, btitle);
+	return Text(m_category2, m_def->path + m_def->category2, m_def->path + m_def->title - 1);
+}
+
+bool Voice::InSameCategory(const Voice& other, int level) const
+{
+	const int len = level == 1 ? m_def->category2 : m_def->title;
+	return len == (level == 1 ? other.m_def->category2 : other.m_def->title) &&
+		strncmp(m_def->path, other.m_def->path, len) == 0;
 }
 
 VoiceList& Presets::Voices()
 {
+	static VoiceList voices(std::begin(voiceDefs), std::end(voiceDefs));
 	return voices;
 }
 
@@ -2809,96 +2994,120 @@ ReverbEffectList& Presets::ReverbEffects()
 	return reverbEffects;
 }
 
-String Presets::VoiceTitle(String voice)
+String Presets::VoiceTitle(const String& voice)
 {
-	if (voice == "")
+	if (voice.isEmpty())
 	{
 		return "";
 	}
 
-	bool isPath = voice.startsWith("PRESET:/VOICE");
-	int num = isPath ? -1 : voice.getIntValue();
-	for (Voice& vc : voices)
+	if (voice.startsWith("PRESET:/VOICE"))
 	{
-		if ((isPath && vc.path == voice) ||
-			(!isPath && vc.num == num))
-		{
-			return vc.title;
-		}
+		auto it = Index().byPath.find(voice.toRawUTF8());
+
+		// unknown path is shown as is
+		return it != Index().byPath.end() ? it->second->GetTitle() : voice;
 	}
 
-	if (!isPath)
+	const int num = voice.getIntValue();
+	auto it = Index().byNum.find(num);
+	if (it != Index().byNum.end())
 	{
-		std::map<int,int>::iterator it = voiceMap.find(num);
-		if (it != voiceMap.end())
+		const NumEntry& entry = it->second;
+		if (!entry.voice)
 		{
-			num = it->second;
-			if (num == -1)
-			{
-				// known num voice but without proper mapping, format as "MSB-LSB-PC"
-				return String(num >> 16 & 0x7f) + "-" + String(num >> 8 & 0x7f) + "-" + String(num & 0x7f);
-			}
-			for (Voice& vc : voices)
-			{
-				if (vc.num == num)
-				{
-					return vc.category2;
-				}
-			}
+			// known num voice but without proper mapping, format as "MSB-LSB-PC"
+			return String(num >> 16 & 0x7f) + "-" + String(num >> 8 & 0x7f) + "-" + String(num & 0x7f);
 		}
 
-		// unknown num voice, format as "MSB LSB PC"
-		return String(num >> 16 & 0x7f) + " " + String(num >> 8 & 0x7f) + " " + String(num & 0x7f);
+		return entry.mapped ? entry.voice->GetCategory2() : entry.voice->GetTitle();
 	}
 
-	// unknown path
-	return voice;
+	// unknown num voice, format as "MSB LSB PC"
+	return String(num >> 16 & 0x7f) + " " + String(num >> 8 & 0x7f) + " " + String(num & 0x7f);
 }
 
-Voice* Presets::FindVoice(String voice)
+Voice* Presets::FindVoice(const String& voice)
 {
-	if (voice == "")
+	if (voice.isEmpty())
 	{
 		return nullptr;
 	}
 
-	bool isPath = voice.startsWith("PRESET:/VOICE");
-	int num = isPath ? -1 : voice.getIntValue();
-	for (Voice& vc : voices)
+	if (voice.startsWith("PRESET:/VOICE"))
+	{
+		auto it = Index().byPath.find(voice.toRawUTF8());
+		return it != Index().byPath.end() ? it->second : nullptr;
+	}
+
+	// for known num voices without proper mapping the entry has no voice
+	auto it = Index().byNum.find(voice.getIntValue());
+	return it != Index().byNum.end() ? it->second.voice : nullptr;
+}
+
+std::vector<Voice*> Presets::SearchVoices(const String& query)
+{
+	SearchIndex& index = Search();
+
+	std::vector<std::string> words;
+	for (const String& word : StringArray::fromTokens(query.toLowerCase(), " ", ""))
 	{
-		if ((isPath && vc.path == voice) ||
-			(!isPath && vc.num == num))
+		if (word.isNotEmpty())
 		{
-			return &vc;
+			words.push_back(word.toRawUTF8());
 		}
 	}
 
-	if (!isPath)
+	// candidates come from the shortest voice list among trigrams of all words,
+	// words shorter than three bytes are only checked below
+	const std::vector<uint16>* candidates = nullptr;
+	for (const std::string& word : words)
 	{
-		std::map<int,int>::iterator it = voiceMap.find(num);
-		if (it != voiceMap.end())
+		for (size_t i = 0; i + 3 <= word.size(); i++)
 		{
-			num = it->second;
-			if (num == -1)
+			auto it = index.trigrams.find(SearchIndex::Trigram(&word[i]));
+			if (it == index.trigrams.end())
 			{
-				// known num voice but without proper mapping
-				return nullptr;
+				return {};
 			}
-			for (Voice& vc : voices)
+			if (!candidates || it->second.size() < candidates->size())
 			{
-				if (vc.num == num)
-				{
-					return &vc;
-				}
+				candidates = &it->second;
+			}
+		}
+	}
+
+	VoiceList& voices = Voices();
+	std::vector<Voice*> result;
+
+	auto check = [&](int i)
+	{
+		for (const std::string& word : words)
+		{
+			if (index.texts[i].find(word) == std::string::npos)
+			{
+				return;
 			}
 		}
+		result.push_back(&voices[i]);
+	};
 
-		// unknown num voice
-		return nullptr;
+	if (candidates)
+	{
+		for (uint16 i : *candidates)
+		{
+			check(i);
+		}
+	}
+	else
+	{
+		for (int i = 0; i < (int)voices.size(); i++)
+		{
+			check(i);
+		}
 	}
 
-	// unknown path
-	return nullptr;
+	return result;
 }
 
 String Presets::ReverbEffectTitle(int num)
@@ -21,16 +21,63 @@
 
 #include "../JuceLibraryCode/JuceHeader.h"
 
-struct Voice
+// Entry of voice catalogue. The catalogue is a constant table compiled into the program,
+// offsets of path parts are calculated at compile time.
+struct VoiceDef
 {
-	Voice(int num, String path, String type);
+	constexpr VoiceDef(int num, const char* path, const char* type) :
+		num(num), path(path), type(type),
+		category1(IndexOf(path, '/', IndexOf(path, '/', 0) + 1) + 1),
+		category2(IndexOf(path, '/', category1) + 1),
+		title(IndexOf(path, '/', category2) + 1),
+		titleEnd(IndexOf(path, '.', title)) {}
+
+	static constexpr int IndexOf(const char* str, char ch, int start)
+	{
+		for (int i = start; str[i]; i++)
+		{
+			if (str[i] == ch)
+			{
+				return i;
+			}
+		}
+		return -1;
+	}
 
 	int num;
-	String path;
-	String type;
-	String title;
-	String category1;
-	String category2;
+	const char* path; // "PRESET:/VOICE/Category1/Category2/Title.Txxx.Type", UTF-8
+	const char* type;
+	int category1;
+	int category2;
+	int title;
+	int titleEnd;
+};
+
+// Voice from catalogue. Texts are created on first use.
+class Voice
+{
+public:
+	explicit Voice(const VoiceDef& def) : m_def(&def) {}
+	int GetNum() const { return m_def->num; }
+	const char* GetRawPath() const { return m_def->path; }
+	const String& GetPath() const;
+	const String& GetType() const;
+	const String& GetTitle() const;
+	const String& GetCategory1() const;
+	const String& GetCategory2() const;
+
+	// Voices of the same category (level 1) or subcategory (level 2) are stored next to each other
+	bool InSameCategory(const Voice& other, int level) const;
+
+private:
+	const VoiceDef* m_def;
+	mutable String m_path;
+	mutable String m_type;
+	mutable String m_title;
+	mutable String m_category1;
+	mutable String m_category2;
+
+	const String& Text(String& text, const char* begin, const char* end) const;
 };
 
 using VoiceList = std::vector<Voice>;
@@ -51,8 +98,12 @@ class Presets
 {
 public:
 	static VoiceList& Voices();
-	static String VoiceTitle(String voice);
-	static Voice* FindVoice(String voice);
+	static String VoiceTitle(const String& voice);
+	static Voice* FindVoice(const String& voice);
+
+	// Voices containing all words of the query in their title, categories or type,
+	// case insensitive, in catalogue order.
+	static std::vector<Voice*> SearchVoices(const String& query);
 	static ReverbEffectList& ReverbEffects();
 	static String ReverbEffectTitle(int num);
 };
@@ -28,8 +28,12 @@ public:
 	RtpMidi(MidiConnector::Listener* listener, bool& connected)
 		: m_listener(listener), m_connected(connected) {}
 	void CheckConenction();
+	void WaitForData(int timeoutMsecs) { _dataPort.waitForPacket(timeoutMsecs); }
 	void OnActiveSensing(void* sender) override;
 	void OnSysEx(void* sender, const byte* data, uint16_t size) override;
+	void OnNoteOn(void* sender, appleMidi::DataByte channel, appleMidi::DataByte note, appleMidi::DataByte velocity) override;
+	void OnNoteOff(void* sender, appleMidi::DataByte channel, appleMidi::DataByte note, appleMidi::DataByte velocity) override;
+	void OnControlChange(void* sender, appleMidi::DataByte channel, appleMidi::DataByte controller, appleMidi::DataByte value) override;
 
 private:
 	unsigned long m_lastSensing = 0;
@@ -68,6 +72,33 @@ void RtpMidi::OnSysEx(void* sender, const byte* data, uint16_t size)
 	}
 }
 
+void RtpMidi::OnNoteOn(void* sender, appleMidi::DataByte channel, appleMidi::DataByte note, appleMidi::DataByte velocity)
+{
+	if (m_listener)
+	{
+		m_listener->IncomingMidiMessage(MidiMessage::noteOn(channel, note, (uint8)velocity)
+			.withTimeStamp(Time::getMillisecondCounterHiRes() * 0.001));
+	}
+}
+
+void RtpMidi::OnNoteOff(void* sender, appleMidi::DataByte channel, appleMidi::DataByte note, appleMidi::DataByte velocity)
+{
+	if (m_listener)
+	{
+		m_listener->IncomingMidiMessage(MidiMessage::noteOff(channel, note, (uint8)velocity)
+			.withTimeStamp(Time::getMillisecondCounterHiRes() * 0.001));
+	}
+}
+
+void RtpMidi::OnControlChange(void* sender, appleMidi::DataByte channel, appleMidi::DataByte controller, appleMidi::DataByte value)
+{
+	if (m_listener)
+	{
+		m_listener->IncomingMidiMessage(MidiMessage::controllerEvent(channel, controller, value)
+			.withTimeStamp(Time::getMillisecondCounterHiRes() * 0.001));
+	}
+}
+
 void RtpMidi::CheckConenction()
 {
 	unsigned long lastTime = Sessions[0].syncronization.lastTime;
@@ -105,7 +136,8 @@ void RtpMidiConnector::run()
 		// process incoming messages
 		rtpMidi.run();
 
-		Thread::sleep(10);
+		// wake up as soon as the next packet arrives to keep latency of notes low
+		rtpMidi.WaitForData(10);
 	}
 }
 
@@ -380,6 +380,7 @@ void SceneComponent::showMenu()
 	menu.addItem(1, "Connection Settings");
 	menu.addItem(2, "Resync State from Piano");
 	menu.addItem(3, "Reset Piano to Default State");
+	menu.addItem(4, "Record Performance", true, performanceRecorder.IsRecording());
 	menu.addSectionHeader("PROGRAM INFO");
 	menu.addItem(99, "Version: \t" + JUCEApplication::getInstance()->getApplicationVersion(), false, false);
 	menu.addItem(100, "Visit Homepage");
@@ -399,6 +400,18 @@ void SceneComponent::showMenu()
 			statusLabel->setText("Resetting...", NotificationType::dontSendNotification);
 			MessageManager::callAsync([=](){pianoController.Reset();});
 			break;
+		case 4:
+			if (performanceRecorder.IsRecording())
+			{
+				performanceRecorder.Stop();
+				statusLabel->setText("Performance saved to " + performanceRecorder.GetFile().getFileName(),
+					NotificationType::dontSendNotification);
+			}
+			else if (performanceRecorder.Start(PerformanceRecorder::DefaultFile()))
+			{
+				statusLabel->setText("Recording performance...", NotificationType::dontSendNotification);
+			}
+			break;
 		case 100:
 			URL("https://github.com/hugbug/conpianist").launchInDefaultBrowser();
 			break;
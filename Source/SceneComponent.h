@@ -29,6 +29,7 @@
 #include "KeyboardComponent.h"
 #include "LocalMidiConnector.h"
 #include "RtpMidiConnector.h"
+#include "PerformanceRecorder.h"
 #include "Settings.h"
 //[/Headers]
 
@@ -77,6 +78,7 @@ private:
     //[UserVariables]   -- You can add your own custom variables in this section.
     AudioDeviceManager audioDeviceManager;
     PianoController pianoController;
+    PerformanceRecorder performanceRecorder{pianoController};
     std::unique_ptr<PlaybackComponent> playbackComponent;
     std::unique_ptr<VoiceComponent> voiceComponent;
     std::unique_ptr<ScoreComponent> scoreComponent;
@@ -0,0 +1,332 @@
+/*
+ *  This file is part of ConPianist. See <https://github.com/hugbug/conpianist>.
+ *
+ *  Copyright (C) 2020 Andrey Prygunkov <hugbug@users.sourceforge.net>
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <lomse_doorway.h>
+#include <lomse_document.h>
+#include <lomse_graphic_view.h>
+#include <lomse_graphical_model.h>
+#include <lomse_interactor.h>
+#include <lomse_presenter.h>
+#include <lomse_xml_parser.h>
+#include <lomse_injectors.h>
+#include <lomse_im_arena.h>
+#include <lomse_model_builder.h>
+#include <lomse_staffobjs_table.h>
+
+#include "ScoreBenchmark.h"
+
+#include <iostream>
+
+using namespace lomse;
+
+bool ScoreBenchmark::ParseCommandLine(const String& commandLine, Options& options)
+{
+	StringArray args = StringArray::fromTokens(commandLine, true);
+
+	if (!args.contains("--benchmark-score"))
+	{
+		return false;
+	}
+
+	for (const String& arg : args)
+	{
+		String value = arg.fromFirstOccurrenceOf("=", false, false);
+
+		if (arg.startsWith("--bench-sizes="))
+		{
+			// 800x600,1920x1080
+			options.sizes.clear();
+			for (const String& size : StringArray::fromTokens(value, ",", ""))
+			{
+				int width = size.upToFirstOccurrenceOf("x", false, true).getIntValue();
+				int height = size.fromFirstOccurrenceOf("x", false, true).getIntValue();
+				if (width > 0 && height > 0)
+				{
+					options.sizes.add({0, 0, width, height});
+				}
+			}
+		}
+		else if (arg.startsWith("--bench-scales="))
+		{
+			options.scales.clear();
+			for (const String& scale : StringArray::fromTokens(value, ",", ""))
+			{
+				if (scale.getFloatValue() > 0)
+				{
+					options.scales.add(scale.getFloatValue());
+				}
+			}
+		}
+		else if (arg.startsWith("--bench-repeat="))
+		{
+			options.repeat = jmax(1, value.getIntValue());
+		}
+		else if (arg.startsWith("--bench-arena="))
+		{
+			options.arena = value.getIntValue() != 0;
+		}
+		else if (arg.startsWith("--bench-threads="))
+		{
+			options.analysisThreads = jmax(0, value.getIntValue());
+		}
+		else if (arg.startsWith("--bench-edits="))
+		{
+			options.edits = jmax(0, value.getIntValue());
+		}
+		else if (!arg.startsWith("--"))
+		{
+			options.scores.add(File::getCurrentWorkingDirectory().getChildFile(arg.unquoted()));
+		}
+	}
+
+	return true;
+}
+
+int ScoreBenchmark::Run(const String& resourcesPath)
+{
+	Array<File> files;
+	if (m_options.scores.isEmpty())
+	{
+		files.add(File(resourcesPath).getChildFile("sample.musicxml"));
+	}
+
+	for (const File& score : m_options.scores)
+	{
+		if (score.isDirectory())
+		{
+			Array<File> found = score.findChildFiles(File::findFiles, true, "*.musicxml;*.xml");
+			found.sort();
+			files.addArray(found);
+		}
+		else
+		{
+			files.add(score);
+		}
+	}
+
+	bool ok = true;
+	for (float scale : m_options.scales)
+	{
+		for (const File& file : files)
+		{
+			ok = Measure(file, scale, resourcesPath) && ok;
+		}
+	}
+
+	return ok ? 0 : 1;
+}
+
+bool ScoreBenchmark::Measure(const File& score, float scale, const String& resourcesPath)
+{
+	if (!score.existsAsFile())
+	{
+		juce::Logger::writeToLog("Score not found: " + score.getFullPathName());
+		return false;
+	}
+
+	// same setup as score view
+	LomseDoorway lomse;
+	lomse.init_library(k_pix_format_bgra32_pre, int(96 * scale), false);
+	lomse.set_default_fonts_path((resourcesPath + "/fonts/").toStdString());
+	lomse.get_musicxml_options()->analysis_threads(m_options.analysisThreads);
+	lomse.get_library_scope()->set_use_imo_arena(m_options.arena);
+
+	const std::string filename = score.getFullPathName().toStdString();
+	std::ostringstream reporter;
+	std::vector<uint8> buffer;
+	RenderingBuffer rbuf;
+	std::unique_ptr<Presenter> presenter;
+
+	// open_document does parsing and building of internal model (staff objects
+	// collection, measures tables), parsing alone is measured separately with the
+	// same method used by open_document (file mapped in memory, parsed in place)
+	double parseTime = 0;
+	double modelTime = 0;
+	for (int i = 0; i < m_options.repeat; i++)
+	{
+		presenter = nullptr;
+
+		const double start = Time::getMillisecondCounterHiRes();
+		{
+			XmlParser parser(reporter);
+			parser.parse_mapped_file(filename);
+		}
+		const double parsed = Time::getMillisecondCounterHiRes();
+		presenter.reset(lomse.open_document(k_view_vertical_book, filename, reporter));
+		const double opened = Time::getMillisecondCounterHiRes();
+
+		const double parse = parsed - start;
+		const double model = jmax(0.0, (opened - parsed) - parse);
+		parseTime = i == 0 ? parse : jmin(parseTime, parse);
+		modelTime = i == 0 ? model : jmin(modelTime, model);
+	}
+
+	Document* doc = presenter->get_document_raw_ptr();
+	ImoScore* imoScore = dynamic_cast<ImoScore*>(doc->get_im_root()->get_content_item(0));
+	if (!imoScore)
+	{
+		juce::Logger::writeToLog("Not a score: " + score.getFullPathName());
+		return false;
+	}
+
+	SpInteractor interactor = presenter->get_interactor(0).lock();
+	ImoPageInfo* pageInfo = doc->get_im_root()->get_page_info();
+	Array<DynamicObject::Ptr> results;
+
+	for (const juce::Rectangle<int>& size : m_options.sizes)
+	{
+		const int width = int(size.getWidth() * scale);
+		const int height = int(size.getHeight() * scale);
+		buffer.assign(size_t(width) * size_t(height) * 4, 0);
+		rbuf.attach(buffer.data(), width, height, width * 4);
+		interactor->set_rendering_buffer(&rbuf);
+
+		pageInfo->set_page_width(LUnits(width) * 26.5f / scale);
+		pageInfo->set_page_height(LUnits(height) * 26.5f / scale);
+		pageInfo->set_top_margin(500);
+		pageInfo->set_left_margin(300);
+		pageInfo->set_right_margin(300);
+		pageInfo->set_bottom_margin(500);
+		pageInfo->set_binding_margin(0);
+
+		// Lomse timing hooks: a dirty document gets a new graphic model on next redraw,
+		// the second redraw only renders the existing one
+		double layoutTime = 0;
+		double renderTime = 0;
+		for (int i = 0; i < m_options.repeat; i++)
+		{
+			doc->set_dirty();
+			interactor->redraw_bitmap();
+			const double layout = interactor->get_elapsed_times()[Interactor::k_timing_gmodel_build_time];
+
+			interactor->redraw_bitmap();
+			const double render = interactor->get_elapsed_times()[Interactor::k_timing_gmodel_draw_time];
+
+			layoutTime = i == 0 ? layout : jmin(layoutTime, layout);
+			renderTime = i == 0 ? render : jmin(renderTime, render);
+		}
+
+		DynamicObject::Ptr result = new DynamicObject();
+		result->setProperty("score", score.getFileName());
+		result->setProperty("bytes", score.getSize());
+		result->setProperty("width", size.getWidth());
+		result->setProperty("height", size.getHeight());
+		result->setProperty("scale", scale);
+		result->setProperty("pages", interactor->get_graphic_model()->get_num_pages());
+		result->setProperty("parse", parseTime);
+		result->setProperty("model", modelTime);
+		result->setProperty("layout", layoutTime);
+		result->setProperty("render", renderTime);
+		results.add(result);
+	}
+
+	const EditTimes editTimes = MeasureEdits(imoScore);
+
+	// objects of internal model are freed with the document
+	ImoArena* arena = doc->get_imo_arena();
+	const int64 arenaAllocations = arena ? int64(arena->num_allocations()) : 0;
+	interactor = nullptr;
+	const double closing = Time::getMillisecondCounterHiRes();
+	presenter = nullptr;
+	const double teardownTime = Time::getMillisecondCounterHiRes() - closing;
+
+	for (DynamicObject::Ptr& result : results)
+	{
+		result->setProperty("teardown", teardownTime);
+		result->setProperty("arenaAllocations", arenaAllocations);
+		if (m_options.edits > 0)
+		{
+			result->setProperty("editIncremental", editTimes.incremental);
+			result->setProperty("editFull", editTimes.full);
+			result->setProperty("editChecksFailed", editTimes.checksFailed);
+		}
+		std::cout << JSON::toString(var(result.get()), true) << std::endl;
+	}
+
+	return true;
+}
+
+ScoreBenchmark::EditTimes ScoreBenchmark::MeasureEdits(ImoScore* score)
+{
+	EditTimes times;
+	if (m_options.edits == 0)
+	{
+		return times;
+	}
+
+	// notes spread evenly through the score
+	std::vector<ImoNote*> allNotes;
+	ColStaffObjs* table = score->get_staffobjs_table();
+	for (ColStaffObjsIterator it = table->begin(); it != table->end(); ++it)
+	{
+		if ((*it)->imo_object()->is_note())
+		{
+			allNotes.push_back(static_cast<ImoNote*>((*it)->imo_object()));
+		}
+	}
+	const int count = jmin(m_options.edits, int(allNotes.size()));
+	if (count == 0)
+	{
+		return times;
+	}
+
+	// each note gets a dot (or loses it) and the model is updated incrementally,
+	// then the note is restored and the model is rebuilt fully;
+	// the check compares incremental update with full rebuild and is not timed
+	StructureChecker checker;
+	std::ostringstream reporter;
+	for (int i = 0; i < count; i++)
+	{
+		ImoNote* note = allNotes[size_t(i) * allNotes.size() / size_t(count)];
+		ColStaffObjsEntry* entry = *score->get_staffobjs_table()->find(note);
+		const int instrument = entry->num_instrument();
+		const int measure = entry->measure();
+		const int noteType = note->get_note_type();
+		const int dots = note->get_dots();
+		const TimeUnits duration = note->get_duration();
+
+		// changes duration of the note, so following staff objects are moved
+		note->set_note_type_and_dots(noteType, dots > 0 ? 0 : 1);
+		note->set_dirty(true);
+		double start = Time::getMillisecondCounterHiRes();
+		score->end_of_changes(instrument, measure, measure);
+		times.incremental += Time::getMillisecondCounterHiRes() - start;
+
+		if (!checker.check(score, reporter))
+		{
+			times.checksFailed++;
+		}
+
+		// duration is restored as is, it could be modified by a tuplet
+		note->set_type_dots_duration(noteType, dots, duration);
+		note->set_dirty(true);
+		start = Time::getMillisecondCounterHiRes();
+		score->end_of_changes();
+		times.full += Time::getMillisecondCounterHiRes() - start;
+	}
+
+	if (times.checksFailed > 0)
+	{
+		juce::Logger::writeToLog(reporter.str());
+	}
+
+	times.incremental /= count;
+	times.full /= count;
+	return times;
+}
@@ -0,0 +1,63 @@
+/*
+ *  This file is part of ConPianist. See <https://github.com/hugbug/conpianist>.
+ *
+ *  Copyright (C) 2020 Andrey Prygunkov <hugbug@users.sourceforge.net>
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "../JuceLibraryCode/JuceHeader.h"
+
+// Measures loading and rendering of scores without GUI, for regression tracking.
+// Each score is parsed, converted to internal model, laid out and rendered at several
+// page sizes and display scales. Results are printed to stdout as JSON, one line per
+// score, size and scale; times are milliseconds, best of all repetitions.
+// Optionally edits of single notes are timed too, updating the internal model
+// incrementally and fully; times are milliseconds, average per edit.
+class ScoreBenchmark
+{
+public:
+	struct Options
+	{
+		Array<File> scores; // files or directories with MusicXML files; bundled sample if empty
+		Array<juce::Rectangle<int>> sizes{{0, 0, 800, 600}, {0, 0, 1920, 1080}};
+		Array<float> scales{1, 2};
+		int repeat = 3;
+		bool arena = true; // internal model in a memory pool, as in score view
+		int analysisThreads = 1; // for MusicXML parts, 0 - one per processor core
+		int edits = 0; // number of notes to edit (add or remove a dot, changing duration)
+	};
+
+	ScoreBenchmark(const Options& options) : m_options(options) {}
+	// Returns process exit code
+	int Run(const String& resourcesPath);
+
+	// Recognizes "--benchmark-score" with optional "--bench-*" settings, see Main.cpp
+	static bool ParseCommandLine(const String& commandLine, Options& options);
+
+private:
+	struct EditTimes
+	{
+		double incremental = 0;
+		double full = 0;
+		int checksFailed = 0; // incremental updates not matching full rebuild
+	};
+
+	Options m_options;
+
+	bool Measure(const File& score, float scale, const String& resourcesPath);
+	EditTimes MeasureEdits(lomse::ImoScore* score);
+};
@@ -26,16 +26,24 @@
 #include <lomse_tempo_line.h>
 #include <lomse_score_algorithms.h>
 #include <lomse_fragment_mark.h>
+#include <lomse_graphical_model.h>
+#include <lomse_box_system.h>
+#include <lomse_injectors.h>
 
 #include "ScoreComponent.h"
+#include "ImageScaler.h"
 
 using namespace lomse;
 
+// viewport is placed slightly above the system Lomse asks to scroll to, empirical value
+static const int OFFSET_CORRECTION = 19;
+
 class LomseScoreComponent : public ScoreComponent, public PianoController::Listener,
-	public Button::Listener
+	public Button::Listener, public MultiTimer
 {
 public:
 	LomseScoreComponent(PianoController& pianoController, Settings& settings);
+	~LomseScoreComponent() override;
 
 	void paint (Graphics& g) override;
 	void resized() override;
@@ -45,29 +53,94 @@ public:
 	void mouseDrag(const MouseEvent& event) override;
 	void mouseWheelMove(const MouseEvent& event, const MouseWheelDetails& details) override;
     void buttonClicked (Button* buttonThatWasClicked) override;
+	void timerCallback(int timerID) override;
 
 	void PianoStateChanged(PianoController::Aspect aspect, PianoController::Channel channel) override;
 
 private:
 	lomse::LomseDoorway m_lomse;
+	// Lomse instance for prerendering on loader thread. Documents of one instance share
+	// fonts and font cache, which must not be used from two threads at once.
+	lomse::LomseDoorway m_prerenderLomse;
 	std::unique_ptr<Presenter> m_presenter;
 	RenderingBuffer m_rbuf_window;
 	std::unique_ptr<juce::Image> m_image;
+	std::unique_ptr<juce::Image> m_scaledImage; // m_image resampled to physical pixels
 	PianoController& m_pianoController;
 	Settings& m_settings;
 	float m_scale = 1;
+	int m_maxImageHeight = 0;
+
+	enum Timers { tmResize, tmTempoLine };
+
+	// Local playback clock, moves tempo line between beats reported by piano
+	TimeUnits m_beatTimepos = 0; // score position of last reported beat
+	TimeUnits m_beatDuration = 0;
+	double m_beatTime = 0; // milliseconds, when last beat was reported
+	TimeUnits m_tempoLineTimepos = 0; // position the tempo line was drawn at
 	int m_scoreId = 0;
 	PianoController::Loop loop{{0,0},{0,0}};
 	PianoController::Position loopStart{0,0};
 	FragmentMark* loopStartMark = nullptr;
 	FragmentMark* loopEndMark = nullptr;
     std::unique_ptr<Button> loadButton;
+	double m_loadProgress = -1; // indeterminate
+	std::unique_ptr<ProgressBar> progressBar;
 
-	void LoadDocument(String filename);
+	// Score prepared on loader thread, handed over to message thread when ready
+	struct LoadedScore
+	{
+		std::unique_ptr<juce::Image> image;
+		RenderingBuffer rbuf;
+		std::unique_ptr<Presenter> presenter;
+		int scoreId = 0;
+		File file;
+		Time modified;
+		int width = 0; // page width the document was laid out for
+		int height = 0; // page height the document was laid out for
+		int64 size = 0; // rough estimate of memory used by document and its graphic model
+	};
+
+	// Current score, its presenter and image are moved to members above while it's shown
+	std::shared_ptr<LoadedScore> m_loaded;
+
+	// Recently shown scores with their layout but without images, most recent first.
+	// Used only on message thread.
+	std::list<std::shared_ptr<LoadedScore>> m_cache;
+
+	// Second copy of the current score, renders on loader thread the part of the score
+	// playback reaches next, so that a page turn is only an exchange of bitmaps.
+	// Created with m_prerenderLomse, as the message thread renders the shown score meanwhile;
+	// counts against the memory budget of the cache.
+	std::shared_ptr<LoadedScore> m_prerender;
+	int m_prerenderY = -1; // viewport rendered into m_prerender->image, -1 - none
+	bool m_prerendering = false;
+
+	// Documents are created, laid out and deleted on loader thread. Lomse isn't thread safe,
+	// the message thread only works with a document after it was handed over. Prerendering
+	// runs while the message thread renders the shown score, so it uses another Lomse instance.
+	ThreadPool m_loader{1};
+	Atomic<int> m_loadGeneration{0};
+
+	void InitLomse(LomseDoorway& lomse);
+	void LoadDocument(LomseDoorway& lomse, LoadedScore& score, const String& filename);
+	void RenderImage(Presenter* presenter, RenderingBuffer& rbuf, std::unique_ptr<juce::Image>& image,
+		int width, int height, bool layout);
 	void PrepareImage();
+	void DrawImage(Graphics& g);
+	void AdoptScore(std::shared_ptr<LoadedScore> score, int generation);
+	void UnloadScore();
+	void CacheScore(std::shared_ptr<LoadedScore> score);
+	std::shared_ptr<LoadedScore> TakeCachedScore(const File& file, Time modified);
+	void TrimCache();
+	void DeleteScore(std::shared_ptr<LoadedScore> score);
+	int PredictViewport(TimeUnits timepos);
+	void Prerender(int y);
+	void AdoptPrerender(std::shared_ptr<LoadedScore> prerender, int y, int generation);
 	LUnits ScaledUnits(int pixels);
 	unsigned GetMouseFlags(const MouseEvent& event);
 	void UpdateTempoLine(bool scroll);
+	void AnimateTempoLine();
 	void UpdateABMarks(bool force);
 	void BuildControls();
 	void LoadScore(const File& file);
@@ -98,6 +171,9 @@ LomseScoreComponent::LomseScoreComponent(PianoController& pianoController, Setti
 	m_scale = m_settings.zoomUi * Desktop::getInstance().getDisplays().getMainDisplay().scale;
 	int resolution = int(96 * m_scale);
 
+	// image buffer has rows for the whole screen, the window can grow without reallocation
+	m_maxImageHeight = int(Desktop::getInstance().getDisplays().getMainDisplay().totalArea.getHeight() * m_scale);
+
 	lomse::logger.set_logging_mode(lomse::Logger::k_trace_mode);
 
 	// Lomse knows nothing about windows. It renders everything on a bitmap and the
@@ -105,8 +181,9 @@ LomseScoreComponent::LomseScoreComponent(PianoController& pianoController, Setti
 	// Lomse supports a lot of bitmap formats and pixel formats. Therefore, before
 	// using the Lomse library you MUST specify which bitmap formap to use.
 
-	//the pixel format
-	int pixel_format = k_pix_format_rgba32;
+	//the pixel format, premultiplied BGRA is what juce::Image uses internally
+	//(ARGB in native byte order), so the bitmap is drawn without conversion
+	int pixel_format = k_pix_format_bgra32_pre;
 
 	//Lomse default y axis direction is 0 coordinate at top and increases
 	//downwards. For JUCE the Lomse default behaviour is the right behaviour.
@@ -114,10 +191,11 @@ LomseScoreComponent::LomseScoreComponent(PianoController& pianoController, Setti
 
 	//initialize the Lomse library with these values
 	m_lomse.init_library(pixel_format, resolution, reverse_y_axis);
+	InitLomse(m_lomse);
+	m_prerenderLomse.init_library(pixel_format, resolution, reverse_y_axis);
+	InitLomse(m_prerenderLomse);
 
-	m_lomse.set_default_fonts_path((m_settings.resourcesPath + "/fonts/").toStdString());
-
-	//set required callbacks
+	//set required callbacks, only for the shown score
 	m_lomse.set_notify_callback(this, LomseEventWrapper);
 
 	BuildControls();
@@ -125,15 +203,35 @@ LomseScoreComponent::LomseScoreComponent(PianoController& pianoController, Setti
 	pianoController.AddListener(this);
 }
 
+LomseScoreComponent::~LomseScoreComponent()
+{
+	// queued jobs are dropped; a running job uses members of this component and
+	// Lomse can't interrupt loading, so wait for it however long it takes
+	m_loadGeneration = -1;
+	m_loader.removeAllJobs(true, -1);
+}
+
 void LomseScoreComponent::BuildControls()
 {
     loadButton.reset(new TextButton("Load Button"));
     addAndMakeVisible(loadButton.get());
     loadButton->setButtonText("Load Score");
     loadButton->addListener(this);
+
+	progressBar.reset(new ProgressBar(m_loadProgress));
+	addChildComponent(progressBar.get());
+	progressBar->setTextToDisplay("Loading score...");
 }
 
-void LomseScoreComponent::LoadDocument(String filename)
+void LomseScoreComponent::InitLomse(LomseDoorway& lomse)
+{
+	lomse.set_default_fonts_path((m_settings.resourcesPath + "/fonts/").toStdString());
+
+	//allocate internal model of each document in its own memory pool
+	lomse.get_library_scope()->set_use_imo_arena(true);
+}
+
+void LomseScoreComponent::LoadDocument(LomseDoorway& lomse, LoadedScore& score, const String& filename)
 {
 	//first, we will create a 'presenter'. It takes care of creating and maintaining
 	//all objects and relationships between the document, its views and the interactors
@@ -141,19 +239,19 @@ void LomseScoreComponent::LoadDocument(String filename)
 	if (filename.isNotEmpty())
 	{
 		// load from file
-		m_presenter.reset(m_lomse.open_document(lomse::k_view_vertical_book, filename.toStdString()));
+		score.presenter.reset(lomse.open_document(lomse::k_view_vertical_book, filename.toStdString()));
 	}
 	else
 	{
 		// empty document
-		m_presenter.reset(m_lomse.new_document(lomse::k_view_vertical_book));
+		score.presenter.reset(lomse.new_document(lomse::k_view_vertical_book));
 	}
 
 	//get the pointer to the interactor, set the rendering buffer and register for
 	//receiving desired events
-	SpInteractor interactor = m_presenter->get_interactor(0).lock();
+	SpInteractor interactor = score.presenter->get_interactor(0).lock();
 	//connect the View with the window buffer
-	interactor->set_rendering_buffer(&m_rbuf_window);
+	interactor->set_rendering_buffer(&score.rbuf);
 	//ask to receive desired events
 	interactor->add_event_handler(k_update_window_event, this, UpdateWindowWrapper);
 
@@ -161,64 +259,88 @@ void LomseScoreComponent::LoadDocument(String filename)
 	interactor->define_beat(k_beat_bottom_ts);
 
 	// visuals
-	interactor->set_view_background(Color(68,62,50)); // dark grey
+	interactor->set_view_background(Color(50,62,68)); // dark grey
 	interactor->set_visual_tracking_mode(k_tracking_tempo_line);
 
 	TempoLine* tempoLine = static_cast<TempoLine*>(interactor->get_tracking_effect(k_tracking_tempo_line));
-	tempoLine->set_color(Color(15, 90, 235, 128));   // light orange
+	tempoLine->set_color(Color(235, 90, 15, 128));   // light orange
 
 	interactor->switch_task(TaskFactory::k_task_drag_view);
 
 	//configure instruments
-	Document* doc = m_presenter->get_document_raw_ptr();
+	Document* doc = score.presenter->get_document_raw_ptr();
 	ImoDocument* imoDoc = doc->get_im_root();
-	ImoScore* score = dynamic_cast<ImoScore*>(imoDoc->get_content_item(0));
-	if (score)
+	ImoScore* imoScore = dynamic_cast<ImoScore*>(imoDoc->get_content_item(0));
+	if (imoScore)
 	{
-		m_scoreId = score->get_id();
-		for (int i = 0; i < score->get_num_instruments(); i++)
+		score.scoreId = imoScore->get_id();
+		for (int i = 0; i < imoScore->get_num_instruments(); i++)
 		{
 			//hide instrument names
-			score->get_instrument(i)->set_name("");
-			score->get_instrument(i)->set_abbrev("");
+			imoScore->get_instrument(i)->set_name("");
+			imoScore->get_instrument(i)->set_abbrev("");
 
 			//show measure numbers
-			score->get_instrument(i)->set_measures_numbering(ImoInstrument::k_system);
+			imoScore->get_instrument(i)->set_measures_numbering(ImoInstrument::k_system);
 		}
 	}
-
-	loop = {{0,0},{0,0}};
 }
 
-void LomseScoreComponent::PrepareImage()
+void LomseScoreComponent::RenderImage(Presenter* presenter, RenderingBuffer& rbuf,
+	std::unique_ptr<juce::Image>& image, int width, int height, bool layout)
 {
-	m_image.reset(new juce::Image(juce::Image::PixelFormat::ARGB,
-		int(getWidth() * m_scale), int(getHeight() * m_scale), false, SoftwareImageType()));
-
-	//creates a bitmap of specified size and associates it to the rendering
-	//buffer for the view. Any existing buffer is automatically deleted
-	juce::Image::BitmapData bitmap(*m_image, juce::Image::BitmapData::readWrite);
+	if (!image || image->getWidth() != width || image->getHeight() < height)
+	{
+		image.reset(new juce::Image(juce::Image::PixelFormat::ARGB,
+			width, jmax(height, m_maxImageHeight), false, SoftwareImageType()));
+	}
 
-	m_rbuf_window.attach(bitmap.data, m_image->getWidth(), m_image->getHeight(), bitmap.lineStride);
+	//associates the bitmap to the rendering buffer for the view,
+	//only top rows of the bitmap are used if the view is smaller
+	juce::Image::BitmapData bitmap(*image, juce::Image::BitmapData::readWrite);
 
-	//adjust the number of measures to fit the area size
-	//adjust page size
-	SpInteractor interactor = m_presenter->get_interactor(0).lock();
-	Document* doc = m_presenter->get_document_raw_ptr();
-	ImoDocument* imoDoc = doc->get_im_root();
-	ImoPageInfo* pageInfo = imoDoc->get_page_info();
+	rbuf.attach(bitmap.data, width, height, bitmap.lineStride);
 
-	pageInfo->set_page_width(ScaledUnits(m_image->getWidth()));
-	pageInfo->set_page_height(ScaledUnits(m_image->getHeight()));
+	SpInteractor interactor = presenter->get_interactor(0).lock();
 
-	pageInfo->set_top_margin(500);
-	pageInfo->set_left_margin(300);
-	pageInfo->set_right_margin(300);
-	pageInfo->set_bottom_margin(500);
-	pageInfo->set_binding_margin(0);
+	// line breaks depend only on page width, otherwise the graphic model is kept
+	if (layout)
+	{
+		//adjust the number of measures to fit the area size
+		//adjust page size
+		Document* doc = presenter->get_document_raw_ptr();
+		ImoDocument* imoDoc = doc->get_im_root();
+		ImoPageInfo* pageInfo = imoDoc->get_page_info();
+
+		pageInfo->set_page_width(ScaledUnits(width));
+		pageInfo->set_page_height(ScaledUnits(height));
+
+		pageInfo->set_top_margin(500);
+		pageInfo->set_left_margin(300);
+		pageInfo->set_right_margin(300);
+		pageInfo->set_bottom_margin(500);
+		pageInfo->set_binding_margin(0);
+
+		interactor->on_document_updated();  //This rebuilds GraphicModel
+	}
 
-	interactor->on_document_updated();  //This rebuilds GraphicModel
 	interactor->redraw_bitmap();
+}
+
+void LomseScoreComponent::PrepareImage()
+{
+	const int width = int(getWidth() * m_scale);
+	const int height = int(getHeight() * m_scale);
+
+	const bool layout = width != m_loaded->width;
+	if (layout)
+	{
+		m_loaded->width = width;
+		m_loaded->height = height;
+		m_prerenderY = -1;
+	}
+
+	RenderImage(m_presenter.get(), m_rbuf_window, m_image, width, height, layout);
 	UpdateABMarks(true);
 	UpdateTempoLine(false);
 }
@@ -230,7 +352,21 @@ LUnits LomseScoreComponent::ScaledUnits(int pixels)
 
 void LomseScoreComponent::UpdateWindow(SpEventInfo event)
 {
-	repaint();
+	// Lomse reports the area changed by overlays (tempo line, marks),
+	// an empty rectangle means the whole view was redrawn
+	SpEventPaint paintEvent(static_pointer_cast<EventPaint>(event));
+	VRect damaged = paintEvent->get_damaged_rectangle();
+	if (damaged.width <= 0 || damaged.height <= 0 || isTimerRunning(tmResize))
+	{
+		repaint();
+		return;
+	}
+
+	const int x1 = int(damaged.x / m_scale);
+	const int y1 = int(damaged.y / m_scale);
+	const int x2 = int(std::ceil((damaged.x + damaged.width) / m_scale));
+	const int y2 = int(std::ceil((damaged.y + damaged.height) / m_scale));
+	repaint(x1, y1, x2 - x1 + 1, y2 - y1 + 1);
 }
 
 void LomseScoreComponent::LomseEvent(SpEventInfo event)
@@ -239,8 +375,22 @@ void LomseScoreComponent::LomseEvent(SpEventInfo event)
 	{
 		SpEventUpdateViewport viewportEvent(static_pointer_cast<EventUpdateViewport>(event));
 		SpInteractor interactor = m_presenter->get_interactor(0).lock();
-		const int OFFSET_CORRECTION = 19; // empirical value
 		int yPos = std::max(viewportEvent->get_new_viewport_y() - OFFSET_CORRECTION, 0);
+
+		if (m_prerender && yPos == m_prerenderY && m_prerender->width == m_loaded->width &&
+			m_prerender->rbuf.height() == m_rbuf_window.height())
+		{
+			// page turn prepared on loader thread, exchange bitmaps and draw only overlays
+			std::swap(m_image, m_prerender->image);
+			m_rbuf_window.attach(m_prerender->rbuf.buf(), m_prerender->rbuf.width(),
+				m_prerender->rbuf.height(), m_prerender->rbuf.stride());
+			m_prerenderY = -1;
+			interactor->new_viewport(0, yPos, false);
+			interactor->redraw_visual_effects();
+			repaint();
+			return;
+		}
+
 		interactor->new_viewport(0, yPos);
 	}
 }
@@ -249,19 +399,30 @@ void LomseScoreComponent::resized()
 {
 	if (m_presenter)
 	{
-		PrepareImage();
+		// relayout when resizing stops, meanwhile the old image is shown scaled
+		startTimer(tmResize, 200);
 	}
 
 	loadButton->setBounds(getWidth() / 2 - 50, 30, 100, 30);
+	progressBar->setBounds(getWidth() / 2 - 100, 30, 200, 30);
 }
 
 void LomseScoreComponent::paint(Graphics& g)
 {
-	if (m_presenter)
+	if (m_presenter && isTimerRunning(tmResize))
 	{
-		g.drawImage(*m_image, 0, 0, getWidth(), getHeight(), 0, 0, m_image->getWidth(), m_image->getHeight());
+		// preview during resizing, scaled to fit the width
+		const int width = int(m_rbuf_window.width());
+		const int height = int(m_rbuf_window.height());
+		g.fillAll(Colour(0xff323e44));
+		g.setImageResamplingQuality(Graphics::lowResamplingQuality);
+		g.drawImage(*m_image, 0, 0, getWidth(), height * getWidth() / width, 0, 0, width, height);
 	}
-	else
+	else if (m_presenter)
+	{
+		DrawImage(g);
+	}
+	else if (!progressBar->isVisible())
 	{
 		String text =
 			"To automatically load score for a song put the score-file in MusicXML format near MIDI-file. "
@@ -273,6 +434,55 @@ void LomseScoreComponent::paint(Graphics& g)
 	}
 }
 
+void LomseScoreComponent::DrawImage(Graphics& g)
+{
+	const float physicalScale = g.getInternalContext().getPhysicalPixelScaleFactor();
+
+	if (std::abs(physicalScale - m_scale) < 0.002f)
+	{
+		// image pixels match screen pixels, the renderer blits the image without resampling
+		Graphics::ScopedSaveState state(g);
+		g.reduceClipRegion(0, 0, getWidth(), getHeight());
+		g.drawImageTransformed(*m_image, AffineTransform::scale(1.0f / m_scale));
+		return;
+	}
+
+	// UI was zoomed or window moved to another display since the document was rendered,
+	// resample the repainted area to screen pixels
+	const int width = roundToInt(getWidth() * physicalScale);
+	const int height = roundToInt(getHeight() * physicalScale);
+	if (!m_scaledImage || m_scaledImage->getWidth() != width || m_scaledImage->getHeight() != height)
+	{
+		m_scaledImage.reset(new juce::Image(juce::Image::PixelFormat::ARGB, width, height, false, SoftwareImageType()));
+	}
+
+	{
+		const juce::Image::BitmapData src(*m_image, juce::Image::BitmapData::readOnly);
+		juce::Image::BitmapData dst(*m_scaledImage, juce::Image::BitmapData::writeOnly);
+		ImageScaler::Scale(src, int(m_rbuf_window.height()), dst,
+			(g.getClipBounds().toFloat() * physicalScale).getSmallestIntegerContainer());
+	}
+
+	g.drawImageTransformed(*m_scaledImage, AffineTransform::scale(1.0f / physicalScale));
+}
+
+void LomseScoreComponent::timerCallback(int timerID)
+{
+	if (timerID == tmTempoLine)
+	{
+		AnimateTempoLine();
+		return;
+	}
+
+	stopTimer(tmResize);
+
+	if (m_presenter)
+	{
+		PrepareImage();
+		repaint();
+	}
+}
+
 void LomseScoreComponent::buttonClicked(Button* buttonThatWasClicked)
 {
 	File initialLocation = File::getSpecialLocation(File::userHomeDirectory);
@@ -389,6 +599,168 @@ void LomseScoreComponent::UpdateTempoLine(bool scroll)
 		interactor->move_tempo_line(m_scoreId,
 			songPosition.measure - 1, songPosition.beat - 1);
 	}
+
+	// piano reports only beats, during playback the line moves on between them
+	Document* doc = m_presenter->get_document_raw_ptr();
+	ImoScore* score = dynamic_cast<ImoScore*>(doc->get_im_root()->get_content_item(0));
+	if (!score)
+	{
+		return;
+	}
+
+	m_beatTimepos = ScoreAlgorithms::get_timepos_for(score, songPosition.measure - 1, songPosition.beat - 1);
+	m_beatDuration = ScoreAlgorithms::get_timepos_for(score, songPosition.measure - 1, songPosition.beat) - m_beatTimepos;
+	m_beatTime = Time::getMillisecondCounterHiRes();
+	m_tempoLineTimepos = m_beatTimepos;
+
+	if (m_pianoController.GetPlaying())
+	{
+		startTimer(tmTempoLine, 1000 / 60);
+
+		const int nextViewport = PredictViewport(m_beatTimepos);
+		if (nextViewport >= 0)
+		{
+			Prerender(nextViewport);
+		}
+	}
+	else
+	{
+		stopTimer(tmTempoLine);
+	}
+}
+
+void LomseScoreComponent::AnimateTempoLine()
+{
+	const int tempo = m_pianoController.GetTempo();
+	if (!m_presenter || !m_pianoController.GetPlaying() || tempo <= 0)
+	{
+		stopTimer(tmTempoLine);
+		return;
+	}
+
+	// not beyond next beat, if the piano is late the line waits for it there
+	const double beats = (Time::getMillisecondCounterHiRes() - m_beatTime) * tempo / 60000;
+	const TimeUnits timepos = m_beatTimepos + m_beatDuration * jmin(beats, 1.0);
+	if (timepos == m_tempoLineTimepos)
+	{
+		return;
+	}
+
+	// time grid of the system gives x-position between notes, only the
+	// overlay layer is redrawn unless the view has to scroll
+	m_tempoLineTimepos = timepos;
+	m_presenter->get_interactor(0).lock()->move_tempo_line(m_scoreId, timepos);
+}
+
+int LomseScoreComponent::PredictViewport(TimeUnits timepos)
+{
+	// Lomse scrolls when playback reaches a system which isn't fully visible,
+	// the viewport then starts at the top of that system
+	SpInteractor interactor = m_presenter->get_interactor(0).lock();
+	GraphicModel* gmodel = interactor->get_graphic_model();
+	Pixels viewportX, viewportY;
+	interactor->get_viewport(&viewportX, &viewportY);
+
+	GmoBoxSystem* system = gmodel ? gmodel->get_system_for(m_scoreId, timepos) : nullptr;
+	while (system)
+	{
+		const int page = system->get_parent_doc_page()->get_number() - 1;
+		double left = system->get_left();
+		double top = system->get_top();
+		double bottom = top + system->get_height();
+		interactor->model_point_to_screen(&left, &top, page);
+		interactor->model_point_to_screen(&left, &bottom, page);
+
+		if (int(bottom) > int(m_rbuf_window.height()))
+		{
+			return std::max(viewportY + int(top) - OFFSET_CORRECTION, 0);
+		}
+
+		GmoBoxSystem* next = gmodel->get_system_for(m_scoreId, system->end_time());
+		system = next != system ? next : nullptr;
+	}
+
+	// rest of the score is visible
+	return -1;
+}
+
+void LomseScoreComponent::Prerender(int y)
+{
+	if (m_prerendering || !m_loaded || m_loaded->file == File() || y == m_prerenderY)
+	{
+		return;
+	}
+
+	// the copy of the score must fit into the memory budget
+	if (!m_prerender && m_loaded->size > int64(m_settings.scoreCacheSize) * 1024 * 1024)
+	{
+		return;
+	}
+
+	const int generation = m_loadGeneration.get();
+	const File file = m_loaded->file;
+	const int width = m_loaded->width;
+	const int pageHeight = m_loaded->height;
+	const int height = int(m_rbuf_window.height());
+	const int64 size = m_loaded->size;
+	std::shared_ptr<LoadedScore> prerender = m_prerender ? std::move(m_prerender) : std::make_shared<LoadedScore>();
+	m_prerenderY = -1;
+	m_prerendering = true;
+	SafePointer<LomseScoreComponent> self(this);
+
+	m_loader.addJob([=]()
+	{
+		if (m_loadGeneration.get() == generation)
+		{
+			if (!prerender->presenter)
+			{
+				prerender->file = file;
+				prerender->size = size;
+				LoadDocument(m_prerenderLomse, *prerender, file.getFullPathName());
+			}
+
+			SpInteractor interactor = prerender->presenter->get_interactor(0).lock();
+			if (prerender->width != width || prerender->height != pageHeight)
+			{
+				// same line and page breaks as the shown score
+				RenderImage(prerender->presenter.get(), prerender->rbuf, prerender->image, width, pageHeight, true);
+				prerender->width = width;
+				prerender->height = pageHeight;
+			}
+
+			interactor->new_viewport(0, y, false);
+			RenderImage(prerender->presenter.get(), prerender->rbuf, prerender->image, width, height, false);
+		}
+
+		MessageManager::callAsync([=]()
+		{
+			if (self)
+			{
+				self->AdoptPrerender(prerender, y, generation);
+			}
+		});
+	});
+}
+
+void LomseScoreComponent::AdoptPrerender(std::shared_ptr<LoadedScore> prerender, int y, int generation)
+{
+	m_prerendering = false;
+
+	if (m_loadGeneration.get() != generation)
+	{
+		DeleteScore(std::move(prerender));
+		return;
+	}
+
+	// the window may have been resized meanwhile
+	const bool valid = prerender->width == m_loaded->width && prerender->height == m_loaded->height &&
+		prerender->rbuf.height() == m_rbuf_window.height();
+
+	m_prerender = std::move(prerender);
+	m_prerenderY = valid ? y : -1;
+
+	// make room for the copy
+	TrimCache();
 }
 
 void LomseScoreComponent::UpdateABMarks(bool force)
@@ -414,7 +786,7 @@ void LomseScoreComponent::UpdateABMarks(bool force)
 				loop.begin.measure > 0 ? loop.begin.measure - 1 : loopStart.measure - 1,
 				loop.begin.measure > 0 ? loop.begin.beat - 1 : loopStart.beat - 1);
 			loopStartMark = interactor->add_fragment_mark_at_note_rest(m_scoreId, timepos);
-			loopStartMark->color(Color(15, 90, 235, 128)); // light orange
+			loopStartMark->color(Color(235, 90, 15, 128)); // light orange
 			loopStartMark->type(k_mark_open_rounded);
 			loopStartMark->x_shift(-5);
 		}
@@ -424,7 +796,7 @@ void LomseScoreComponent::UpdateABMarks(bool force)
 			TimeUnits timepos = ScoreAlgorithms::get_timepos_for(score, loop.end.measure - 1, loop.end.beat - 1);
 			timepos -= 1;
 			loopEndMark = interactor->add_fragment_mark_at_note_rest(m_scoreId, timepos);
-			loopEndMark->color(Color(15, 90, 235, 128)); // light orange
+			loopEndMark->color(Color(235, 90, 15, 128)); // light orange
 			loopEndMark->type(k_mark_close_rounded);
 		}
 	}
@@ -432,7 +804,7 @@ void LomseScoreComponent::UpdateABMarks(bool force)
 
 void LomseScoreComponent::LoadSong()
 {
-	m_presenter = nullptr;
+	UnloadScore();
 
 	File file = File(m_pianoController.GetSongName()).withFileExtension(".musicxml");
 	if (!file.existsAsFile())
@@ -447,6 +819,7 @@ void LomseScoreComponent::LoadSong()
 	}
 	else
 	{
+		progressBar->setVisible(false);
 		loadButton->setVisible(m_presenter == nullptr);
 		repaint();
 	}
@@ -454,15 +827,166 @@ void LomseScoreComponent::LoadSong()
 
 void LomseScoreComponent::LoadScore(const File& file)
 {
-	m_presenter = nullptr;
+	UnloadScore();
+
+	// parsing and layout of large scores take seconds, the result of
+	// the last request replaces the current score when ready
+	const int generation = ++m_loadGeneration;
+	const Time modified = file.getLastModificationTime();
+	const int width = int(getWidth() * m_scale);
+	const int height = int(getHeight() * m_scale);
+	std::shared_ptr<LoadedScore> cached = TakeCachedScore(file, modified);
+	SafePointer<LomseScoreComponent> self(this);
+
+	// a cached score is also handed over through loader thread,
+	// after all jobs using Lomse have finished
+	m_loader.addJob([=]()
+	{
+		if (!cached && m_loadGeneration.get() != generation)
+		{
+			return;
+		}
 
-	LoadDocument(file.getFullPathName());
+		std::shared_ptr<LoadedScore> score = cached;
+		if (!score)
+		{
+			score = std::make_shared<LoadedScore>();
+			score->file = file;
+			score->modified = modified;
+			score->width = width;
+			score->height = height;
+			score->size = file.getSize() * 8;
+			LoadDocument(m_lomse, *score, file.getFullPathName());
+			RenderImage(score->presenter.get(), score->rbuf, score->image, width, height, true);
+		}
 
-	if (m_presenter)
+		MessageManager::callAsync([=]()
+		{
+			if (self)
+			{
+				self->AdoptScore(score, generation);
+			}
+		});
+	});
+
+	loadButton->setVisible(false);
+	progressBar->setVisible(true);
+	repaint();
+}
+
+void LomseScoreComponent::AdoptScore(std::shared_ptr<LoadedScore> score, int generation)
+{
+	if (m_loadGeneration.get() != generation)
 	{
+		// a newer score is being loaded, keep this one for later
+		CacheScore(score);
+		return;
+	}
+
+	m_loaded = score;
+	m_image = std::move(score->image);
+	m_presenter = std::move(score->presenter);
+	m_scoreId = score->scoreId;
+
+	m_presenter->get_interactor(0).lock()->set_rendering_buffer(&m_rbuf_window);
+
+	loop = {{0,0},{0,0}};
+
+	if (m_image && (int)score->rbuf.width() == int(getWidth() * m_scale) &&
+		(int)score->rbuf.height() == int(getHeight() * m_scale))
+	{
+		m_rbuf_window.attach(score->rbuf.buf(), score->rbuf.width(), score->rbuf.height(), score->rbuf.stride());
+		UpdateABMarks(true);
+		UpdateTempoLine(false);
+	}
+	else
+	{
+		// resized while loading or taken from cache
 		PrepareImage();
 	}
 
-	loadButton->setVisible(m_presenter == nullptr);
+	progressBar->setVisible(false);
+	loadButton->setVisible(false);
 	repaint();
 }
+
+void LomseScoreComponent::UnloadScore()
+{
+	++m_loadGeneration;
+
+	if (m_presenter)
+	{
+		m_loaded->presenter = std::move(m_presenter);
+		CacheScore(m_loaded);
+	}
+
+	if (m_prerender)
+	{
+		DeleteScore(std::move(m_prerender));
+	}
+
+	m_loaded = nullptr;
+	m_image = nullptr;
+	m_prerenderY = -1;
+}
+
+void LomseScoreComponent::CacheScore(std::shared_ptr<LoadedScore> score)
+{
+	// the image is recreated on next use, the graphic model is kept
+	score->image = nullptr;
+	score->rbuf.attach(nullptr, 0, 0, 0);
+	score->presenter->get_interactor(0).lock()->set_rendering_buffer(&score->rbuf);
+
+	m_cache.push_front(score);
+	TrimCache();
+}
+
+std::shared_ptr<LomseScoreComponent::LoadedScore> LomseScoreComponent::TakeCachedScore(const File& file, Time modified)
+{
+	for (auto it = m_cache.begin(); it != m_cache.end(); it++)
+	{
+		std::shared_ptr<LoadedScore> score = *it;
+		if (score->file == file)
+		{
+			m_cache.erase(it);
+			if (score->modified == modified)
+			{
+				return score;
+			}
+
+			// file has changed
+			DeleteScore(std::move(score));
+			break;
+		}
+	}
+
+	return nullptr;
+}
+
+void LomseScoreComponent::TrimCache()
+{
+	const int64 budget = int64(m_settings.scoreCacheSize) * 1024 * 1024;
+
+	// the copy of current score for prerendering is kept in memory too
+	int64 size = m_prerender ? m_prerender->size : 0;
+	for (std::shared_ptr<LoadedScore>& score : m_cache)
+	{
+		size += score->size;
+	}
+
+	// least recently used first
+	while (!m_cache.empty() && size > budget)
+	{
+		std::shared_ptr<LoadedScore> score = std::move(m_cache.back());
+		m_cache.pop_back();
+		size -= score->size;
+		DeleteScore(std::move(score));
+	}
+}
+
+void LomseScoreComponent::DeleteScore(std::shared_ptr<LoadedScore> score)
+{
+	// delete document on loader thread, where other documents may be loading at this time;
+	// the job must hold the last reference
+	m_loader.addJob([score = std::move(score)]() mutable { score.reset(); });
+}
@@ -48,6 +48,7 @@ void Settings::Save()
 	prop.setValue("Window.Height", windowPos.getHeight());
 	prop.setValue("Keyboard.Visible", keyboardVisible);
 	prop.setValue("Keyboard.Channel", keyboardChannel);
+	prop.setValue("ScoreCache.Size", scoreCacheSize);
 
 	prop.save();
 	sendChangeMessage();
@@ -66,4 +67,5 @@ void Settings::Load()
 	windowPos.setHeight(prop.getIntValue("Window.Height", windowPos.getHeight()));
 	keyboardVisible = prop.getIntValue("Keyboard.Visible", keyboardVisible);
 	keyboardChannel = prop.getIntValue("Keyboard.Channel", keyboardChannel);
+	scoreCacheSize = prop.getIntValue("ScoreCache.Size", scoreCacheSize);
 }
@@ -35,6 +35,7 @@ public:
 	bool keyboardVisible = false;
 	int keyboardChannel = 1;
 	String resourcesPath;
+	int scoreCacheSize = 64; // megabytes of recently shown scores kept in memory
 
 private:
 	PropertiesFile::Options opt;
@@ -0,0 +1,70 @@
+/*
+ *  This file is part of ConPianist. See <https://github.com/hugbug/conpianist>.
+ *
+ *  Copyright (C) 2020 Andrey Prygunkov <hugbug@users.sourceforge.net>
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "UiUpdater.h"
+
+UiUpdater::Client::Client()
+{
+	m_updater->m_clients.add(this);
+}
+
+UiUpdater::Client::~Client()
+{
+	m_updater->m_clients.removeFirstMatchingValue(this);
+}
+
+void UiUpdater::Client::Invalidate(PianoController::Aspect aspect)
+{
+	m_dirtyAspects |= 1u << aspect;
+	m_updater->m_dirty = true;
+}
+
+void UiUpdater::Client::Painted()
+{
+	m_updater->m_repaints++;
+}
+
+void UiUpdater::timerCallback()
+{
+	if (m_dirty.exchange(false))
+	{
+		// a client may be deleted or created by an update of another one
+		for (int i = 0; i < m_clients.size(); i++)
+		{
+			Client* client = m_clients[i];
+			const uint32 aspects = client->m_dirtyAspects.exchange(0);
+			if (aspects != 0)
+			{
+				client->UpdateState(aspects);
+			}
+		}
+	}
+
+	const double now = Time::getMillisecondCounterHiRes();
+	if (now - m_repaintsCounted >= 1000)
+	{
+		if (m_repaints > 0)
+		{
+			DBG("UI repaints: " << m_repaints << " per second");
+		}
+		m_repaintsPerSecond = m_repaints;
+		m_repaints = 0;
+		m_repaintsCounted = now;
+	}
+}
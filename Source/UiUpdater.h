@@ -0,0 +1,69 @@
+/*
+ *  This file is part of ConPianist. See <https://github.com/hugbug/conpianist>.
+ *
+ *  Copyright (C) 2020 Andrey Prygunkov <hugbug@users.sourceforge.net>
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "../JuceLibraryCode/JuceHeader.h"
+#include "PianoController.h"
+
+// Coalesces state notifications of piano controller into one update per display frame.
+// When connecting, the piano reports hundreds of changes in a burst; updating components
+// on every notification meant as many layout passes and repaints.
+class UiUpdater : private Timer
+{
+public:
+	// Component receiving coalesced updates. Aspects can be invalidated from any thread,
+	// the component is updated on message thread.
+	class Client
+	{
+	public:
+		Client();
+		virtual ~Client();
+		void Invalidate(PianoController::Aspect aspect);
+		// To be called from paint() of the component, for counting repaints
+		void Painted();
+
+		// Called once per frame with all aspects changed since previous call,
+		// the component only updates controls showing these aspects
+		virtual void UpdateState(uint32 aspects) = 0;
+
+		static constexpr uint32 AllAspects = ~0u;
+		static bool HasAspect(uint32 aspects, PianoController::Aspect aspect)
+			{ return (aspects & (1u << aspect)) != 0; }
+
+	private:
+		SharedResourcePointer<UiUpdater> m_updater;
+		std::atomic<uint32> m_dirtyAspects{0};
+
+		friend class UiUpdater;
+	};
+
+	UiUpdater() { startTimerHz(60); }
+	// Number of client repaints made during the last second, for regression tracking
+	int GetRepaintsPerSecond() { return m_repaintsPerSecond; }
+
+private:
+	Array<Client*> m_clients;
+	std::atomic<bool> m_dirty{false};
+	int m_repaints = 0;
+	int m_repaintsPerSecond = 0;
+	double m_repaintsCounted = 0;
+
+	void timerCallback() override;
+};
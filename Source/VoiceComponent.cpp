@@ -28,12 +28,73 @@
 class VoiceTreeItem : public TreeViewItem
 {
 public:
-	VoiceTreeItem(Voice& voice) : m_voice(&voice), m_title(voice.title) {}
+	VoiceTreeItem(Voice& voice) : m_voice(&voice), m_title(voice.GetTitle()) {}
 	VoiceTreeItem(const String& title) : m_title(title) {}
 
+	// Category item; its sub-items are created when the item is opened and deleted when it is closed
+	VoiceTreeItem(const String& title, int level, int begin, int end) :
+		m_title(title), m_level(level), m_begin(begin), m_end(end) {}
+
 	bool mightContainSubItems() override
 	{
-		return getNumSubItems() != 0;
+		return m_level > 0 || getNumSubItems() != 0;
+	}
+
+	void itemOpennessChanged(bool isNowOpen) override
+	{
+		if (m_level == 0)
+		{
+			return;
+		}
+
+		if (isNowOpen && getNumSubItems() == 0)
+		{
+			AddItems(this, m_level + 1, m_begin, m_end);
+		}
+		else if (!isNowOpen)
+		{
+			clearSubItems();
+		}
+	}
+
+	// Adds items for voices in range [begin, end) of voice list,
+	// grouped into categories of given level (1, 2) or as voice items (level 3)
+	static void AddItems(TreeViewItem* parent, int level, int begin, int end)
+	{
+		VoiceList& voices = Presets::Voices();
+		for (int i = begin; i < end; )
+		{
+			if (level > 2)
+			{
+				parent->addSubItem(new VoiceTreeItem(voices[i++]));
+				continue;
+			}
+
+			int last = i + 1;
+			while (last < end && voices[last].InSameCategory(voices[i], level))
+			{
+				last++;
+			}
+
+			parent->addSubItem(new VoiceTreeItem(level == 1 ? voices[i].GetCategory1() :
+				voices[i].GetCategory2(), level, i, last));
+			i = last;
+		}
+	}
+
+	// Sub-item for voice or category containing voice with given index in voice list
+	VoiceTreeItem* FindSubItem(int index)
+	{
+		Voice* voice = &Presets::Voices()[index];
+		for (int i = 0; i < getNumSubItems(); i++)
+		{
+			VoiceTreeItem* sub = (VoiceTreeItem*)getSubItem(i);
+			if (sub->m_voice ? sub->m_voice == voice : sub->m_begin <= index && index < sub->m_end)
+			{
+				return sub;
+			}
+		}
+		return nullptr;
 	}
 
 	int getItemHeight() const override
@@ -49,7 +110,7 @@ public:
 			g.setColour(isSelected() && getOwnerView()->isEnabled() ? Colours::white : Colours::grey);
 			g.drawRoundedRectangle(offset, 6, 45, height - 12, 2, 1);
 			g.setFont(10);
-			g.drawText(m_voice->type, offset, 0, 45, height, Justification::centred);
+			g.drawText(m_voice->GetType(), offset, 0, 45, height, Justification::centred);
 			offset += 55;
 		}
 
@@ -78,6 +139,9 @@ public:
 
 	Voice* m_voice = nullptr;
 	String m_title;
+	int m_level = 0;
+	int m_begin = 0;
+	int m_end = 0;
 
 	JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(VoiceTreeItem)
 };
@@ -250,12 +314,24 @@ VoiceComponent::VoiceComponent (PianoController& pianoController)
                                ImageCache::getFromMemory (BinaryData::buttoncontextmenu_png, BinaryData::buttoncontextmenu_pngSize), 1.000f, Colour (0x00000000),
                                Image(), 0.750f, Colour (0x00000000),
                                Image(), 1.000f, Colour (0x00000000));
+    searchEdit.reset (new TextEditor ("Search Edit"));
+    addAndMakeVisible (searchEdit.get());
+    searchEdit->setMultiLine (false);
+    searchEdit->setReturnKeyStartsNewLine (false);
+    searchEdit->setReadOnly (false);
+    searchEdit->setScrollbarsShown (false);
+    searchEdit->setCaretVisible (true);
+    searchEdit->setPopupMenuEnabled (true);
+    searchEdit->setText (String());
+
 
     //[UserPreSize]
     targetGroup->setColour(GroupComponent::outlineColourId, Colours::transparentBlack);
     targetGroup->setText("");
 
    	voicesTree->setColour(TreeView::ColourIds::selectedItemBackgroundColourId, Colour(0xFEEE6C0A));
+	searchEdit->setTextToShowWhenEmpty("Search", Colours::grey);
+	searchEdit->addListener(this);
 
     //[/UserPreSize]
 
@@ -303,6 +379,7 @@ VoiceComponent::~VoiceComponent()
     leftMenuButton = nullptr;
     mainMenuButton2 = nullptr;
     mainMenuButton = nullptr;
+    searchEdit = nullptr;
 
 
     //[Destructor]. You can add your own custom destruction code here..
@@ -328,7 +405,7 @@ void VoiceComponent::resized()
     //[/UserPreResize]
 
     targetGroup->setBounds (0, -8, getWidth() - 0, 104);
-    voicesTree->setBounds (8, (-8) + 104, getWidth() - 16, getHeight() - 98);
+    voicesTree->setBounds (8, (-8) + 104 + 40, getWidth() - 16, getHeight() - 138);
     leftVoiceButton->setBounds (0 + 16, (-8) + 55, proportionOfWidth (0.3029f), 28);
     mainVoiceButton->setBounds (0 + (getWidth() - 0) / 2 - (proportionOfWidth (0.3029f) / 2), (-8) + 55, proportionOfWidth (0.3029f), 28);
     layerVoiceButton->setBounds (0 + (getWidth() - 0) - 16 - proportionOfWidth (0.3029f), (-8) + 55, proportionOfWidth (0.3029f), 28);
@@ -347,6 +424,7 @@ void VoiceComponent::resized()
     leftMenuButton->setBounds ((0 + 16) + 0, 8, 28, 28);
     mainMenuButton2->setBounds ((0 + (getWidth() - 0) / 2 - (proportionOfWidth (0.3029f) / 2)) + 24, 8, 28, 28);
     mainMenuButton->setBounds ((0 + (getWidth() - 0) / 2 - (proportionOfWidth (0.3029f) / 2)) + 0, 8, 28, 28);
+    searchEdit->setBounds (8, (-8) + 104 + 4, getWidth() - 16, 28);
     //[UserResized] Add your own custom resize handling here..
     //[/UserResized]
 }
@@ -479,25 +557,45 @@ void VoiceComponent::updateVoiceState()
 void VoiceComponent::buildVoiceTree()
 {
 	voicesTree->setRootItem(rootItem = new VoiceTreeItem(""));
+	filterVoices("");
+}
+
+void VoiceComponent::filterVoices(const String& query)
+{
+	rootItem->clearSubItems();
 
-	VoiceTreeItem* category1 = nullptr;
-	VoiceTreeItem* category2 = nullptr;
-	for (Voice& voice : Presets::Voices())
+	if (query.trim().isEmpty())
 	{
-		if (!category1 || category1->m_title != voice.category1)
-		{
-			rootItem->addSubItem(category1 = new VoiceTreeItem(voice.category1));
-		}
+		VoiceTreeItem::AddItems(rootItem, 1, 0, (int)Presets::Voices().size());
+		return;
+	}
 
-		if (!category2 || category2->m_title != voice.category2)
-		{
-			category1->addSubItem(category2 = new VoiceTreeItem(voice.category2));
-		}
+	for (Voice* voice : Presets::SearchVoices(query))
+	{
+		rootItem->addSubItem(new VoiceTreeItem(*voice));
+	}
+}
 
-		category2->addSubItem(new VoiceTreeItem(voice));
+void VoiceComponent::textEditorTextChanged(TextEditor& editor)
+{
+	filterVoices(editor.getText());
+}
+
+void VoiceComponent::textEditorReturnKeyPressed(TextEditor& editor)
+{
+	// choose the only found voice
+	if (editor.getText().trim().isNotEmpty() && rootItem->getNumSubItems() == 1)
+	{
+		voiceItemClicked(((VoiceTreeItem*)rootItem->getSubItem(0))->m_voice);
 	}
 }
 
+void VoiceComponent::textEditorEscapeKeyPressed(TextEditor& editor)
+{
+	editor.setText("", false);
+	filterVoices("");
+}
+
 void VoiceComponent::voiceItemClicked(Voice* voice)
 {
 	PianoController::Channel channel =
@@ -506,7 +604,7 @@ void VoiceComponent::voiceItemClicked(Voice* voice)
 		PianoController::chMain;
 
 	pianoController.SetActive(channel, true);
-	pianoController.SetVoice(channel, voice->path);
+	pianoController.SetVoice(channel, voice->GetPath());
 }
 
 void VoiceComponent::voiceButtonClicked(Button* button)
@@ -525,54 +623,34 @@ void VoiceComponent::voiceButtonClicked(Button* button)
 
 void VoiceComponent::scrollToVoice(const String& preset)
 {
-	struct Traversal // a trick to decalre local function
+	if (searchEdit->getText().isNotEmpty())
 	{
-		static VoiceTreeItem* Find(TreeViewItem* item, const String& preset)
-		{
-			for (int i = 0; i < item->getNumSubItems(); i++)
-			{
-				VoiceTreeItem* sub = (VoiceTreeItem*)item->getSubItem(i);
-				if (sub->getNumSubItems() > 0)
-				{
-					VoiceTreeItem* ret = Find(sub, preset);
-					if (ret)
-					{
-						return ret;
-					}
-				}
-				bool isPath = preset.startsWith("PRESET:");
-				if (sub->m_voice && ((isPath && preset == sub->m_voice->path) ||
-					(!isPath && preset.getIntValue() == sub->m_voice->num)))
-				{
-					return sub;
-				}
-			}
-			return nullptr;
-		}
+		searchEdit->setText("", false);
+		filterVoices("");
+	}
 
-		static void CollapseAll(TreeViewItem* item)
-		{
-			for (int i = 0; i < item->getNumSubItems(); i++)
-			{
-				VoiceTreeItem* sub = (VoiceTreeItem*)item->getSubItem(i);
-				if (sub->getNumSubItems() > 0)
-				{
-					sub->setOpen(false);
-					CollapseAll(sub);
-				}
-			}
-		}
-	};
+	// closing a category deletes all its sub-items
+	for (int i = 0; i < rootItem->getNumSubItems(); i++)
+	{
+		rootItem->getSubItem(i)->setOpen(false);
+	}
+
+	Voice* voice = Presets::FindVoice(preset);
+	if (!voice)
+	{
+		return;
+	}
 
-	Traversal::CollapseAll(voicesTree->getRootItem());
+	const int index = (int)(voice - Presets::Voices().data());
+	VoiceTreeItem* voiceItem = (VoiceTreeItem*)rootItem;
+	while (voiceItem && !voiceItem->m_voice)
+	{
+		voiceItem->setOpen(true);
+		voiceItem = voiceItem->FindSubItem(index);
+	}
 
-	VoiceTreeItem* voiceItem = Traversal::Find(voicesTree->getRootItem(), preset);
 	if (voiceItem)
 	{
-		for (TreeViewItem* node = voiceItem; node; node = node->getParentItem())
-		{
-			node->setOpen(true);
-		}
 		voiceItem->setSelected(true, true);
 		voicesTree->scrollToKeepItemVisible(voiceItem);
 	}
@@ -617,7 +695,7 @@ void VoiceComponent::showMenu(Button* button, PianoController::Channel channel)
 BEGIN_JUCER_METADATA
 
 <JUCER_COMPONENT documentType="Component" className="VoiceComponent" componentName=""
-                 parentClasses="public Component, public PianoController::Listener"
+                 parentClasses="public Component, public PianoController::Listener, public TextEditor::Listener"
                  constructorParams="PianoController&amp; pianoController" variableInitialisers="pianoController(pianoController)"
                  snapPixels="8" snapActive="1" snapShown="1" overlayOpacity="0.330"
                  fixedSize="0" initialWidth="600" initialHeight="400">
@@ -626,7 +704,7 @@ BEGIN_JUCER_METADATA
                   virtualName="" explicitFocusOrder="0" pos="0 -8 0M 104" title="Target"
                   textpos="36"/>
   <TREEVIEW name="Voices TreeView" id="5c337882807de41a" memberName="voicesTree"
-            virtualName="" explicitFocusOrder="0" pos="8 0R 16M 98M" posRelativeY="56427593ca278ddd"
+            virtualName="" explicitFocusOrder="0" pos="8 40R 16M 138M" posRelativeY="56427593ca278ddd"
             rootVisible="0" openByDefault="0"/>
   <TEXTBUTTON name="Left Voice Button" id="f4f376ddb622016f" memberName="leftVoiceButton"
               virtualName="" explicitFocusOrder="0" pos="16 55 30.295% 28"
@@ -734,6 +812,10 @@ BEGIN_JUCER_METADATA
                resourceNormal="BinaryData::buttoncontextmenu_png" opacityNormal="1.0"
                colourNormal="0" resourceOver="" opacityOver="0.75" colourOver="0"
                resourceDown="" opacityDown="1.0" colourDown="0"/>
+  <TEXTEDITOR name="Search Edit" id="4d0a5c31e8b7f912" memberName="searchEdit"
+              virtualName="" explicitFocusOrder="0" pos="8 4R 16M 28" posRelativeY="56427593ca278ddd"
+              initialText="" multiline="0" retKeyStartsLine="0" readonly="0"
+              scrollbars="0" caret="1" popupmenu="1"/>
 </JUCER_COMPONENT>
 
 END_JUCER_METADATA
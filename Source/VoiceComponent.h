@@ -37,6 +37,7 @@
 */
 class VoiceComponent  : public Component,
                         public PianoController::Listener,
+                        public TextEditor::Listener,
                         public Button::Listener
 {
 public:
@@ -52,6 +53,10 @@ public:
     void voiceItemClicked(Voice* voice);
     void voiceButtonClicked(Button* button);
     void scrollToVoice(const String& preset);
+    void filterVoices(const String& query);
+    void textEditorTextChanged(TextEditor& editor) override;
+    void textEditorReturnKeyPressed(TextEditor& editor) override;
+    void textEditorEscapeKeyPressed(TextEditor& editor) override;
 	void updateEnabledControls();
 	void showMenu(Button* button, PianoController::Channel channel);
     //[/UserMethods]
@@ -89,6 +94,7 @@ private:
     std::unique_ptr<ImageButton> leftMenuButton;
     std::unique_ptr<ImageButton> mainMenuButton2;
     std::unique_ptr<ImageButton> mainMenuButton;
+    std::unique_ptr<TextEditor> searchEdit;
 
 
     //==============================================================================